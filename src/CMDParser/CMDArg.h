@@ -39,6 +39,10 @@ namespace PWT::CLI {
         SET_APPLY_PROFILE,
         SET_IMPORT_PROFILES,
         SET_MAKE_PROFILE,
+        SET_FORCE_APPLY,
+        SET_DRY_RUN,
+        SET_VERIFY,
+        SET_STRICT,
         SET_DEVICE_SETTINGS,
         SET_WIN_SCHEMES_RESET_DEFAULTS,
         SET_WIN_SCHEMES_REPLACE_DEFAULTS,
@@ -46,6 +50,10 @@ namespace PWT::CLI {
         SET_WIN_DELETE_SCHEMES,
         SET_WIN_RESET_SCHEMES,
         SET_WIN_SCHEME_COPY_SETTINGS,
-        SET_WIN_DUPLICATE_SCHEME
+        SET_WIN_DUPLICATE_SCHEME,
+
+        OUTPUT_FIELDS,
+        OUTPUT_FORMAT,
+        OUTPUT_FILE
     };
 }
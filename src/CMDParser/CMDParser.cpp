@@ -16,13 +16,41 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <QCoreApplication>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <charconv>
+#include <algorithm>
+#include <utility>
 
 #include "CMDParser.h"
 #include "../../version.h"
-#include "SettingsArguments.h"
+#include "../Utils.h"
 #include "pwtShared/DaemonSettings.h"
 
 namespace PWT::CLI {
+    [[nodiscard]]
+    static QString toQString(const std::string_view str) {
+        return QString::fromLatin1(str.data(), static_cast<qsizetype>(str.size()));
+    }
+
+    [[nodiscard]]
+    static bool parseIndex(const std::string_view str, int &idx) {
+        const char *end = str.data() + str.size();
+        const auto [ptr, ec] = std::from_chars(str.data(), end, idx);
+
+        return !str.empty() && ec == std::errc() && ptr == end && idx >= 0;
+    }
+
+    template<size_t... I>
+    static std::array<SettingValue, settingsCount> makeSettingValues(std::pmr::memory_resource *resource, std::index_sequence<I...>) {
+        return {((void)I, SettingValue(resource))...};
+    }
+
+    CMDParser::CMDParser(const QString &appDataPath):
+        completionCache(appDataPath), settingValues(makeSettingValues(&arena, std::make_index_sequence<settingsCount>())) {}
+
     void CMDParser::nextArg(const int inc) {
         cmdArgc -= inc;
         cmdArgv += inc;
@@ -36,6 +64,26 @@ namespace PWT::CLI {
         return std::strcmp(arg, expected) == 0;
     }
 
+    bool CMDParser::getOptionValue(const char *option, QString &value) {
+        const size_t len = std::strlen(option);
+
+        if (cmdArgc <= 0 || std::strncmp(cmdArgv[0], option, len) != 0)
+            return false;
+
+        if (cmdArgv[0][len] == '=') { // --option=value
+            value = QString(cmdArgv[0] + len + 1);
+            nextArg();
+            return true;
+
+        } else if (cmdArgv[0][len] == '\0' && cmdArgc > 1) { // --option value
+            value = QString(cmdArgv[1]);
+            nextArg(2);
+            return true;
+        }
+
+        return false;
+    }
+
     bool CMDParser::parse(int argc, char *argv[]) {
         if (argc <= 1 || isArg(argv[0], "help")) {
             showHelp();
@@ -45,7 +93,41 @@ namespace PWT::CLI {
         cmdArgc = --argc;
         cmdArgv = ++argv;
 
-        return parseMode();
+        return parseOutputOptions() && parseMode();
+    }
+
+    bool CMDParser::parseOutputOptions() {
+        QHash<QString, QVariant> outputData {
+            {"path", QString()},
+            {"compression", QStringLiteral("none")}
+        };
+
+        while (cmdArgc) {
+            QString value;
+
+            if (getOptionValue(outputOpt, value)) {
+                if (value.isEmpty()) {
+                    showHelp();
+                    return false;
+                }
+
+                outputData.insert("path", value);
+
+            } else if (getOptionValue(compressOpt, value)) {
+                if (value != "gzip" && value != "zstd") {
+                    showHelp();
+                    return false;
+                }
+
+                outputData.insert("compression", value);
+
+            } else {
+                break;
+            }
+        }
+
+        argumentsMap.insert(CMDArg::OUTPUT_FILE, outputData);
+        return true;
     }
 
     bool CMDParser::parseMode() {
@@ -63,7 +145,7 @@ namespace PWT::CLI {
             nextArg();
             return parseSetCommand();
 
-        } else if (isArg(cmdArgv[0], "help")) {
+        } else if (isArg(cmdArgv[0], helpArg)) {
             nextArg();
             return parseAdvHelpCommand();
         }
@@ -73,50 +155,13 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseGetCommand() {
-        if (cmdArgc <= 0 || isArg(cmdArgv[0], "help")) {
-            showGetHelp();
-            return false;
-
-        } else if (isArg(cmdArgv[0], listDaemonsArg)) {
-            argumentsMap.insert(CMDArg::GET_DAEMON_LIST, {});
-            return true;
+        const CommandInfo *cmd = cmdArgc > 0 ? findCommand(getCommands, cmdArgv[0]) : nullptr;
 
-        } else if (isArg(cmdArgv[0], dataPathArg)) {
-            argumentsMap.insert(CMDArg::GET_DATA_PATH, {});
-            return true;
-
-        } else if (isArg(cmdArgv[0], daemonSettArg)) {
+        if (cmd != nullptr) {
             nextArg();
 
-            if (parseDaemon()) {
-                argumentsMap.insert(CMDArg::GET_DAEMON_SETTINGS, {});
+            if (parseCommand(*cmd))
                 return true;
-            }
-        } else if (isArg(cmdArgv[0], deviceInfoArg)) {
-            nextArg();
-
-            if (parseDaemon()) {
-                argumentsMap.insert(CMDArg::GET_DEVICE_INFO, {});
-                return true;
-            }
-        } else if (isArg(cmdArgv[0], profilesArg)) {
-            nextArg();
-
-            if (parseDaemon()) {
-                argumentsMap.insert(CMDArg::GET_PROFILE_LIST, {});
-                return true;
-            }
-        } else if (isArg(cmdArgv[0], exportProfilesArg)) {
-            nextArg();
-            return parseExportProfiles();
-
-        } else if (isArg(cmdArgv[0], deviceDataArg)) {
-            nextArg();
-
-            if (parseDaemon()) {
-                argumentsMap.insert(CMDArg::GET_DEVICE_DATA, {});
-                return true;
-            }
         }
 
         showGetHelp();
@@ -124,53 +169,79 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseSetCommand() {
-        if (cmdArgc <= 0 || isArg(cmdArgv[0], "help")) {
-            showSetHelp();
-            return false;
-
-        } else if (isArg(cmdArgv[0], resetCliSettArg)) {
-            argumentsMap.insert(CMDArg::SET_RESET_CLI_SETTINGS, {});
-            return true;
-
-        } else if (isArg(cmdArgv[0], addDaemonsArg)) {
-            nextArg();
-            return parseAddDaemons();
-
-        } else if (isArg(cmdArgv[0], removeDaemonsArg)) {
-            nextArg();
-            return parseRemoveDaemons();
-
-        } else if (isArg(cmdArgv[0], daemonSettArg)) {
-            nextArg();
-            return parseSetDaemonSettings();
-
-        } else if (isArg(cmdArgv[0], deleteProfileArg)) {
-            nextArg();
-            return parseDeleteProfile();
+        const CommandInfo *cmd = cmdArgc > 0 ? findCommand(setCommands, cmdArgv[0]) : nullptr;
 
-        } else if (isArg(cmdArgv[0], applyProfileArg)) {
+        if (cmd != nullptr) {
             nextArg();
-            return parseApplyProfile();
 
-        } else if (isArg(cmdArgv[0], importProfilesArg)) {
-            nextArg();
-            return parseImportProfiles();
-
-        } else if (isArg(cmdArgv[0], deviceSettingsArg)) {
-            nextArg();
-            return parseDeviceSettings();
+            if (parseCommand(*cmd))
+                return true;
         }
 
         showSetHelp();
         return false;
     }
 
-    bool CMDParser::parseAdvHelpCommand() const {
+    bool CMDParser::parseCommand(const CommandInfo &cmd) {
+        switch (cmd.arg) {
+            case CMDArg::GET_EXPORT_PROFILES:
+                return parseExportProfiles();
+            case CMDArg::GET_DEVICE_DATA:
+                return parseDeviceData();
+            case CMDArg::SET_ADD_DAEMONS:
+                return parseAddDaemons();
+            case CMDArg::SET_REMOVE_DAEMONS:
+                return parseRemoveDaemons();
+            case CMDArg::SET_DAEMON_SETTINGS:
+                return parseSetDaemonSettings();
+            case CMDArg::SET_DELETE_PROFILE:
+                return parseDeleteProfile();
+            case CMDArg::SET_APPLY_PROFILE:
+                return parseApplyProfile();
+            case CMDArg::SET_IMPORT_PROFILES:
+                return parseImportProfiles();
+            case CMDArg::SET_DEVICE_SETTINGS:
+                return parseDeviceSettings();
+            case CMDArg::SET_MAKE_PROFILE:
+                return parseMakeProfile();
+            case CMDArg::SET_WIN_ACTIVE_SCHEME:
+                return parseWindowsActiveScheme();
+            case CMDArg::SET_WIN_DELETE_SCHEMES:
+                return parseWindowsDeleteSchemes();
+            case CMDArg::SET_WIN_RESET_SCHEMES:
+                return parseWindowsResetSchemes();
+            case CMDArg::SET_WIN_SCHEME_COPY_SETTINGS:
+                return parseWindowsCopySchemeSettings();
+            case CMDArg::SET_WIN_DUPLICATE_SCHEME:
+                return parseWindowsDuplicateScheme();
+            default:
+                break;
+        }
+
+        // no arguments, other than the daemon
+        if (cmd.daemon && !parseDaemon())
+            return false;
+
+        argumentsMap.insert(cmd.arg, {});
+        return true;
+    }
+
+    bool CMDParser::parseAdvHelpCommand() {
         if (cmdArgc < 1) {
             showHelp();
             return false;
         }
 
+        // list only the settings supported by a daemon, from its completion cache
+        if (cmdArgc > 1) {
+            helpSettingsFilter = completionCache.readSettings(QString(cmdArgv[1]));
+
+            if (helpSettingsFilter.isEmpty()) {
+                printError(QString("no capabilities cached for daemon '%1', run: %2 %3 %1").arg(cmdArgv[1], getArg, deviceDataArg));
+                return false;
+            }
+        }
+
         if (isArg(cmdArgv[0], helpLinuxSettingsArg))
             showLinuxSettingsListHelp();
 #ifdef WITH_AMD
@@ -187,6 +258,12 @@ namespace PWT::CLI {
 #endif
         else if (isArg(cmdArgv[0], helpFanControlSettingsArg))
             showFanControlSettingsListHelp();
+        else if (isArg(cmdArgv[0], helpBashCompletionArg))
+            showBashCompletion();
+        else if (isArg(cmdArgv[0], helpZshCompletionArg))
+            showZshCompletion();
+        else if (isArg(cmdArgv[0], helpFishCompletionArg))
+            showFishCompletion();
         else
             showHelp();
 
@@ -216,10 +293,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseAddDaemons() {
-        if (cmdArgc < 3 || cmdArgc % 3 != 0) {
-            showSetHelp();
+        if (cmdArgc < 3 || cmdArgc % 3 != 0)
             return false;
-        }
 
         QList<QString> daemonsData;
 
@@ -235,10 +310,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseRemoveDaemons() {
-        if (cmdArgc <= 0) {
-            showSetHelp();
+        if (cmdArgc <= 0)
             return false;
-        }
 
         QList<QString> daemons;
 
@@ -252,10 +325,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseSetDaemonSettings() {
-        if (cmdArgc < 2 || !parseDaemon()) {
-            showSetHelp();
+        if (cmdArgc < 2 || !parseDaemon())
             return false;
-        }
 
         QHash<QString, QVariant> data;
 
@@ -275,30 +346,31 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseDeleteProfile() {
-        if (cmdArgc < 2 || !parseDaemon()) {
-            showSetHelp();
+        if (cmdArgc < 2 || !parseDaemon())
             return false;
-        }
 
         argumentsMap.insert(CMDArg::SET_DELETE_PROFILE, {{"profile", QString(cmdArgv[0])}});
         return true;
     }
 
     bool CMDParser::parseApplyProfile() {
-        if (cmdArgc < 2 || !parseDaemon()) {
-            showSetHelp();
+        if (cmdArgc < 2 || !parseDaemon())
             return false;
-        }
 
         argumentsMap.insert(CMDArg::SET_APPLY_PROFILE, {{"profile", QString(cmdArgv[0])}});
+        nextArg();
+
+        if (cmdArgc > 0 && isArg(cmdArgv[0], verifyArg)) {
+            argumentsMap.insert(CMDArg::SET_VERIFY, {});
+            nextArg();
+        }
+
         return true;
     }
 
     bool CMDParser::parseExportProfiles() {
-        if (cmdArgc < 3 || !parseDaemon()) {
-            showGetHelp();
+        if (cmdArgc < 3 || !parseDaemon())
             return false;
-        }
 
         argumentsMap.insert(CMDArg::GET_EXPORT_PROFILES, {
             {"path", QString(cmdArgv[0])},
@@ -308,10 +380,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseImportProfiles() {
-        if (cmdArgc < 2 || !parseDaemon()) {
-            showSetHelp();
+        if (cmdArgc < 2 || !parseDaemon())
             return false;
-        }
 
         QList<QString> profiles;
 
@@ -325,10 +395,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseWindowsActiveScheme() {
-        if (cmdArgc < 1) {
-            showSetHelp();
+        if (cmdArgc < 1)
             return false;
-        }
 
         argumentsMap.insert(CMDArg::SET_WIN_ACTIVE_SCHEME, {{"guid", QString(cmdArgv[0])}});
         nextArg();
@@ -336,10 +404,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseWindowsDeleteSchemes() {
-        if (cmdArgc < 1) {
-            showSetHelp();
+        if (cmdArgc < 1)
             return false;
-        }
 
         const QList<QString> guids = QString(cmdArgv[0]).split(',', Qt::SkipEmptyParts);
 
@@ -350,10 +416,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseWindowsResetSchemes() {
-        if (cmdArgc < 1) {
-            showSetHelp();
+        if (cmdArgc < 1)
             return false;
-        }
 
         const QList<QString> guids = QString(cmdArgv[0]).split(',', Qt::SkipEmptyParts);
 
@@ -364,10 +428,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseWindowsCopySchemeSettings() {
-        if (cmdArgc < 4) {
-            showSetHelp();
+        if (cmdArgc < 4)
             return false;
-        }
 
         argumentsMap.insert(CMDArg::SET_WIN_SCHEME_COPY_SETTINGS, {
             {"from_scheme", QString(cmdArgv[0])},
@@ -381,10 +443,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseWindowsDuplicateScheme() {
-        if (cmdArgc < 3) {
-            showSetHelp();
+        if (cmdArgc < 3)
             return false;
-        }
 
         argumentsMap.insert(CMDArg::SET_WIN_DUPLICATE_SCHEME, {
             {"base_scheme", QString(cmdArgv[0])},
@@ -397,10 +457,8 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseMakeProfile() {
-        if (cmdArgc < 1) {
-            showSetHelp();
+        if (cmdArgc < 1)
             return false;
-        }
 
         argumentsMap.insert(CMDArg::SET_MAKE_PROFILE, {{"name", QString(cmdArgv[0])}});
 
@@ -409,90 +467,315 @@ namespace PWT::CLI {
     }
 
     bool CMDParser::parseDeviceSettings() {
-        if (cmdArgc < 2 || !parseDaemon()) {
-            showSetHelp();
+        if (cmdArgc < 2 || !parseDaemon())
             return false;
-        }
-
-        QHash<QString, QVariant> data;
 
         while (cmdArgc) {
-            if (isArg(cmdArgv[0], winPsResetDefaultsArg)) {
-                nextArg();
-                argumentsMap.insert(CMDArg::SET_WIN_SCHEMES_RESET_DEFAULTS, {});
+            QString settingsFile;
 
-            } else if (isArg(cmdArgv[0], winPsReplaceDefaultsArg)) {
-                nextArg();
-                argumentsMap.insert(CMDArg::SET_WIN_SCHEMES_REPLACE_DEFAULTS, {});
+            if (getOptionValue(fromOpt, settingsFile)) {
+                if (!parseSettingsFile(settingsFile))
+                    return false;
 
-            } else if (isArg(cmdArgv[0], winPsActiveSchemeArg)) {
-                nextArg();
+                continue;
+            }
 
-                if (!parseWindowsActiveScheme())
-                    return false;
+            const CommandInfo *option = findCommand(deviceSettingsOptions, cmdArgv[0]);
+
+            if (option == nullptr)
+                option = findCommand(windowsSchemesOptions, cmdArgv[0]);
 
-            } else if (isArg(cmdArgv[0], winPsDeleteSchemesArg)) {
+            if (option != nullptr) {
                 nextArg();
 
-                if (!parseWindowsDeleteSchemes())
+                if (!parseCommand(*option))
                     return false;
 
-            } else if (isArg(cmdArgv[0], winPsResetSchemesArg)) {
+            } else if (parseSetting(cmdArgv[0])) {
                 nextArg();
 
-                if (!parseWindowsResetSchemes())
+            } else {
+                return false;
+            }
+        }
+
+        argumentsMap.insert(CMDArg::SET_DEVICE_SETTINGS, {});
+        return true;
+    }
+
+    bool CMDParser::parseSetting(const std::string_view arg) {
+        const size_t valPos = arg.find('=');
+
+        if (valPos == std::string_view::npos || valPos == 0 || valPos == (arg.size() - 1)) {
+            printError(QString("invalid setting: %1").arg(arg.data()));
+            return false;
+        }
+
+        const std::string_view val = arg.substr(valPos + 1);
+        std::string_view name = arg.substr(0, valPos);
+        std::string_view idx;
+        const bool indexed = name.back() == ']';
+
+        if (indexed) { // setting[idx]
+            const size_t idxPos = name.find('[');
+
+            if (idxPos == std::string_view::npos) {
+                printError(QString("invalid setting: %1").arg(arg.data()));
+                return false;
+            }
+
+            idx = name.substr(idxPos + 1, name.size() - idxPos - 2);
+            name = name.substr(0, idxPos);
+        }
+
+        const SettingInfo *setting = findSetting(name);
+
+        if (setting == nullptr) { // may be a setting from a different build, ignore it unless strict
+            printError(QString("unknown setting: %1").arg(arg.data()));
+            unknownSettings.append(QString::fromUtf8(name.data(), static_cast<qsizetype>(name.size())));
+            return true;
+        }
+
+        const QString error = storeSetting(*setting, indexed, idx, QString::fromUtf8(val.data(), static_cast<qsizetype>(val.size())));
+
+        if (!error.isEmpty()) {
+            printError(QString("%1: %2").arg(arg.data(), error));
+            return false;
+        }
+
+        return true;
+    }
+
+    QString CMDParser::storeSetting(const SettingInfo &setting, const bool indexed, const std::string_view idx, const QString &val) {
+        if (indexed != (setting.scope != SettingScope::Global))
+            return indexed ? QStringLiteral("setting has no index") : QStringLiteral("missing index");
+
+        const bool numericIdx = setting.scope == SettingScope::Thread || setting.scope == SettingScope::Core || setting.scope == SettingScope::GPU;
+        std::pmr::vector<SettingValue::IndexSelector> idxSelectors(&arena);
+
+        // devices, fans and schemes are addressed by name
+        if (indexed && idx.empty() && !numericIdx)
+            return QStringLiteral("missing index");
+
+        if (numericIdx && !parseIndexSelectors(idx, setting.scope, idxSelectors))
+            return QStringLiteral("invalid index");
+
+        const std::optional<SettingValue::Value> value = SettingValue::fromString(setting.type, val);
+        SettingValue &settingVal = settingValues[static_cast<int>(setting.id)];
+
+        if (!value)
+            return QStringLiteral("invalid value");
+
+        if (!indexed)
+            settingVal.set(*value);
+        else if (!numericIdx)
+            settingVal.set(QString::fromUtf8(idx.data(), static_cast<qsizetype>(idx.size())), *value);
+        else
+            settingVal.set(std::move(idxSelectors), *value);
+
+        return {};
+    }
+
+    bool CMDParser::parseSettingsFile(const QString &path) {
+        QFile file(path);
+        const bool isOpen = path == "-" ? file.open(stdin, QIODevice::ReadOnly) : file.open(QIODevice::ReadOnly);
+
+        if (!isOpen) {
+            printError(QString("%1: %2").arg(path, file.errorString()));
+            return false;
+        }
+
+        const QByteArray data = file.readAll();
+        const auto lineAt = [&data](const qsizetype offset) { return data.first(qBound<qsizetype>(0, offset, data.size())).count('\n') + 1; };
+        QJsonParseError parseError;
+        const QJsonDocument doc = QJsonDocument::fromJson(data, &parseError);
+
+        if (parseError.error != QJsonParseError::NoError) {
+            printError(QString("%1:%2: %3").arg(path).arg(lineAt(parseError.offset)).arg(parseError.errorString()));
+            return false;
+
+        } else if (!doc.isObject()) {
+            printError(QString("%1:1: settings must be an object").arg(path));
+            return false;
+        }
+
+        // json values keep no position, find the key text to report a line
+        const auto keyOffset = [&data](const QString &key, const qsizetype from) { return data.indexOf(QString("\"%1\"").arg(key).toUtf8(), from); };
+        const auto toString = [](const QJsonValue &value) -> QString {
+            switch (value.type()) {
+                case QJsonValue::Bool:
+                    return value.toBool() ? QStringLiteral("1") : QStringLiteral("0");
+                case QJsonValue::Double:
+                    return QString::number(value.toDouble(), 'g', 17);
+                case QJsonValue::String:
+                    return value.toString();
+                default:
+                    break;
+            }
+
+            return {};
+        };
+        const QJsonObject settings = doc.object();
+
+        for (const auto &[key, value]: settings.asKeyValueRange()) {
+            const QString name = key.toString();
+            const QByteArray nameData = name.toUtf8();
+            const qsizetype nameOffset = keyOffset(name, 0);
+            const SettingInfo *setting = findSetting(std::string_view(nameData.constData(), nameData.size()));
+
+            if (setting == nullptr) {
+                printError(QString("%1:%2: unknown setting: %3").arg(path).arg(lineAt(nameOffset)).arg(name));
+                unknownSettings.append(name);
+                continue;
+            }
+
+            QList<std::pair<QString, QJsonValue>> entries;
+
+            if (value.isObject()) { // setting[idx]: value
+                const QJsonObject obj = value.toObject();
+
+                for (const auto &[idx, idxValue]: obj.asKeyValueRange())
+                    entries.append({idx.toString(), idxValue});
+
+            } else if (value.isArray()) { // per index values, null to skip an index
+                const QJsonArray arr = value.toArray();
+
+                for (int i=0,l=arr.size(); i<l; ++i) {
+                    if (!arr[i].isNull())
+                        entries.append({QString::number(i), arr[i]});
+                }
+            }
+
+            if (entries.isEmpty() && !value.isObject() && !value.isArray()) {
+                const QString error = storeSetting(*setting, setting->scope != SettingScope::Global, {}, toString(value));
+
+                if (!error.isEmpty()) {
+                    printError(QString("%1:%2: %3: %4").arg(path).arg(lineAt(nameOffset)).arg(name, error));
                     return false;
+                }
 
-            } else if (isArg(cmdArgv[0], winPsCopySchemeSettingsArg)) {
-                nextArg();
+                continue;
+            }
+
+            for (const auto &[idx, idxValue]: entries) {
+                const QByteArray idxData = idx.toUtf8();
+                const QString error = storeSetting(*setting, true, std::string_view(idxData.constData(), idxData.size()), toString(idxValue));
+
+                if (!error.isEmpty()) {
+                    const qsizetype idxOffset = value.isObject() ? keyOffset(idx, nameOffset) : nameOffset;
 
-                if (!parseWindowsCopySchemeSettings())
+                    printError(QString("%1:%2: %3[%4]: %5").arg(path).arg(lineAt(idxOffset)).arg(name, idx, error));
                     return false;
+                }
+            }
+        }
 
-            } else if (isArg(cmdArgv[0], winPsDuplicateSchemeArg)) {
-                nextArg();
+        return true;
+    }
+
+    bool CMDParser::parseIndexSelectors(const std::string_view idx, const SettingScope scope, std::pmr::vector<SettingValue::IndexSelector> &selectors) const {
+        if (idx.empty()) { // all
+            selectors.push_back({TopologyGroup::None, 0, SettingValue::maxIndex});
+            return true;
+        }
 
-                if (!parseWindowsDuplicateScheme())
+        size_t pos = 0;
+
+        // list of indexes, ranges or topology groups: 0-15,32-47,64 or smt_siblings
+        while (pos <= idx.size()) {
+            const size_t end = std::min(idx.find(',', pos), idx.size());
+            const std::string_view item = idx.substr(pos, end - pos);
+            const size_t sep = item.find('-', 1);
+            SettingValue::IndexSelector selector;
+
+            pos = end + 1;
+
+            if (parseIndex(item.substr(0, sep), selector.first)) {
+                if (sep == std::string_view::npos)
+                    selector.last = selector.first;
+                else if (!parseIndex(item.substr(sep + 1), selector.last) || selector.last < selector.first)
                     return false;
 
-            } else if (isArg(cmdArgv[0], makeProfileArg)) {
-                nextArg();
+                selectors.push_back(selector);
+                continue;
+            }
+
+            // groups are resolved from cpu topology
+            if (item != smtSiblingsSel || scope != SettingScope::Thread)
+                return false;
+
+            selector.group = TopologyGroup::SmtSiblings;
+            selectors.push_back(selector);
+        }
+
+        return true;
+    }
+
+    bool CMDParser::parseDeviceData() {
+        if (!parseDaemon() || !parseDeviceDataOptions())
+            return false;
+
+        argumentsMap.insert(CMDArg::GET_DEVICE_DATA, {});
+        return true;
+    }
+
+    bool CMDParser::parseDeviceDataOptions() {
+        QHash<QString, QVariant> formatData {
+            {"format", QStringLiteral("json")},
+            {"table", QStringLiteral("cpus")},
+            {"schema", 1}
+        };
+        bool hasTable = false;
+        bool hasSchema = false;
 
-                if (!parseMakeProfile())
+        while (cmdArgc) {
+            QString value;
+
+            if (getOptionValue(fieldsOpt, value)) {
+                if (value.isEmpty())
                     return false;
 
-            } else {
-                const QList<QString> setting = QString(cmdArgv[0]).split('=', Qt::SkipEmptyParts);
+                argumentsMap.insert(CMDArg::OUTPUT_FIELDS, {{"paths", value}});
 
-                nextArg();
+            } else if (getOptionValue(formatOpt, value)) {
+                if (value != "json" && value != "csv" && value != "tsv")
+                    return false;
 
-                if (setting.size() != 2)
-                    continue;
+                formatData.insert("format", value);
 
-                if (setting[0].back() == ']') { // indexed data
-                    const QList<QString> settingArg = setting[0].split('[');
-                    const QString idx = settingArg[1].sliced(0, settingArg[1].size() - 1);
-                    const QString &arg = settingArg[0];
-                    const QString &argVal = setting[1];
-                    QHash<QString, QVariant> argData {};
+            } else if (getOptionValue(tableOpt, value)) {
+                if (value != "cpus" && value != "gpus")
+                    return false;
 
-                    if (data.contains(arg))
-                        argData = data[arg].toHash();
+                formatData.insert("table", value);
+                hasTable = true;
 
-                    if (idx.isEmpty())
-                        argData.insert("all", argVal);
-                    else
-                        argData.insert(idx, argVal);
+            } else if (getOptionValue(schemaOpt, value)) {
+                if (value != "1" && value != "2")
+                    return false;
 
-                    data.insert(arg, argData);
+                formatData.insert("schema", value.toInt());
+                hasSchema = true;
 
-                } else {
-                    data.insert(setting[0], setting[1]);
-                }
+            } else {
+                return false;
             }
         }
 
-        argumentsMap.insert(CMDArg::SET_DEVICE_SETTINGS, data);
+        // options the chosen format would ignore
+        const bool isJson = formatData.value("format").toString() == "json";
+
+        if (isJson && hasTable) {
+            printError(QString("%1 requires %2=csv or %2=tsv").arg(tableOpt, formatOpt));
+            return false;
+        }
+
+        if (!isJson && (argumentsMap.contains(CMDArg::OUTPUT_FIELDS) || hasSchema)) {
+            printError(QString("%1 and %2 require %3=json").arg(fieldsOpt, schemaOpt, formatOpt));
+            return false;
+        }
+
+        argumentsMap.insert(CMDArg::OUTPUT_FORMAT, formatData);
         return true;
     }
 
@@ -503,14 +786,101 @@ namespace PWT::CLI {
         return argumentsMap[arg].value(value);
     }
 
+    bool CMDParser::needsTopology() const {
+        return std::ranges::any_of(settingValues, [](const SettingValue &setting) { return setting.needsTopology(); });
+    }
+
+    QList<Setting> CMDParser::resolveTopology(const CpuTopology &topology) {
+        QList<Setting> unresolved;
+
+        for (int i=0; i<settingsCount; ++i) {
+            if (!settingValues[i].needsTopology())
+                continue;
+
+            if (!settingValues[i].resolve(topology))
+                unresolved.append(static_cast<Setting>(i));
+        }
+
+        return unresolved;
+    }
+
+    void CMDParser::expandIndexedSettings(const int count) {
+        for (int i=0; i<settingsCount; ++i) {
+            switch (settingsSchema[i].scope) {
+                case SettingScope::Thread:
+                case SettingScope::Core:
+                case SettingScope::GPU:
+                    settingValues[i].expand(count);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    QList<SettingError> CMDParser::validateSettings(const DeviceCapabilities &capabilities) const {
+        QList<SettingError> errors;
+
+        for (const SettingInfo &info: settingsSchema) {
+            const SettingValue &setting = settingValues[static_cast<int>(info.id)];
+
+            if (!setting.isSet())
+                continue;
+
+            const QString name = settingName(info.id);
+
+            if (!capabilities.settings.contains(name)) {
+                errors.append({info.id, SettingError::Kind::Unsupported, {}, std::nullopt});
+                continue;
+            }
+
+            const auto range = capabilities.ranges.constFind(name);
+            const auto accepted = capabilities.values.constFind(name);
+
+            for (const SettingValue::Value &value: setting.values()) {
+                if (info.type == SettingType::Int && range != capabilities.ranges.constEnd()) {
+                    const int val = std::get<int>(value);
+
+                    if (val < range->min || val > range->max)
+                        errors.append({info.id, SettingError::Kind::OutOfRange, QString::number(val), *range});
+
+                } else if (info.type == SettingType::String && accepted != capabilities.values.constEnd()) {
+                    const QString &val = std::get<QString>(value);
+
+                    if (!accepted->contains(val))
+                        errors.append({info.id, SettingError::Kind::InvalidValue, val, std::nullopt});
+                }
+            }
+        }
+
+        return errors;
+    }
+
+    QList<SettingError> CMDParser::getUnknownSettings() const {
+        QList<SettingError> errors;
+
+        for (const QString &name: unknownSettings)
+            errors.append({Setting::Count, SettingError::Kind::Unknown, name, std::nullopt});
+
+        return errors;
+    }
+
     void CMDParser::showHelp() const {
         QTextStream ts(stdout);
 
         ts.setFieldAlignment(QTextStream::AlignLeft);
 
         ts << "PowerTunerCLI v" << CLIENT_VER_MAJOR << "." << CLIENT_VER_MINOR << " - GPLv3 kylon\n\n"
-            << "Usage: " << QCoreApplication::applicationName() << " <mode> <options>\n\n"
-            << helpIndent(helpIndentLv1) << "help\n"
+            << "Usage: " << QCoreApplication::applicationName() << " <output options> <mode> <options>\n\n"
+            << "Output options:\n"
+            << helpIndent(helpIndentLv1) << outputOpt << " <file>\n"
+            << helpIndent(helpIndentLv2) << "Write output to <file> instead of stdout.\n"
+            << helpIndent(helpIndentLv2) << "The file is replaced once the command result is completely written, also when the command fails.\n"
+            << helpIndent(helpIndentLv2) << "It is left untouched if writing fails or the command writes nothing.\n\n"
+            << helpIndent(helpIndentLv1) << compressOpt << "=<gzip|zstd>\n"
+            << helpIndent(helpIndentLv2) << "Compress output while writing it.\n\n"
+            << "Modes:\n"
+            << helpIndent(helpIndentLv1) << helpArg << "\n"
             << helpIndent(helpIndentLv2) << "Show help.\n\n"
             << helpIndent(helpIndentLv2) << "Options:\n"
             << helpIndent(helpIndentLv3) << helpLinuxSettingsArg << "\n"
@@ -531,6 +901,11 @@ namespace PWT::CLI {
 #endif
             << helpIndent(helpIndentLv3) << helpFanControlSettingsArg << "\n"
             << helpIndent(helpIndentLv4) << "List fan control settings for " << deviceSettingsArg << " option.\n\n"
+            << helpIndent(helpIndentLv3) << helpBashCompletionArg << ", " << helpZshCompletionArg << ", " << helpFishCompletionArg << "\n"
+            << helpIndent(helpIndentLv4) << "Print a completion script for bash, zsh or fish.\n"
+            << helpIndent(helpIndentLv4) << "Settings and values are offered from the capabilities cached for the daemon.\n\n"
+            << helpIndent(helpIndentLv2) << "Settings lists take an optional saved daemon name, to show only the settings it supports.\n"
+            << helpIndent(helpIndentLv2) << "Capabilities are cached by " << deviceDataArg << " and " << deviceSettingsArg << ".\n\n"
             << helpIndent(helpIndentLv1) << getArg << "\n"
             << helpIndent(helpIndentLv2) << "Request and print data.\n\n"
             << helpIndent(helpIndentLv1) << setArg << "\n"
@@ -541,6 +916,42 @@ namespace PWT::CLI {
         ;
     }
 
+    void CMDParser::showCommandsHelp(QTextStream &ts, const std::span<const CommandInfo> commands) const {
+        for (const CommandInfo &cmd: commands) {
+            ts << helpIndent(helpIndentLv1) << toQString(cmd.name);
+
+            if (cmd.daemon)
+                ts << " " << daemonArg;
+
+            if (!cmd.usage.empty())
+                ts << " " << toQString(cmd.usage);
+
+            ts << "\n";
+
+            for (const QString &line: toQString(cmd.help).split('\n'))
+                ts << helpIndent(helpIndentLv2) << line << "\n";
+
+            ts << "\n";
+            showCommandOptionsHelp(ts, cmd.arg);
+        }
+    }
+
+    void CMDParser::showCommandOptionsHelp(QTextStream &ts, const CMDArg arg) const {
+        switch (arg) {
+            case CMDArg::GET_DEVICE_DATA:
+                showDeviceDataOptionsHelp(ts);
+                break;
+            case CMDArg::SET_DAEMON_SETTINGS:
+                showDaemonSettingsListHelp(ts);
+                break;
+            case CMDArg::SET_DEVICE_SETTINGS:
+                showDeviceSettingsOptionsHelp(ts);
+                break;
+            default:
+                break;
+        }
+    }
+
     void CMDParser::showGetHelp() const {
         QTextStream ts(stdout);
 
@@ -549,23 +960,28 @@ namespace PWT::CLI {
         ts << "PowerTunerCLI v" << CLIENT_VER_MAJOR << "." << CLIENT_VER_MINOR << " - GPLv3 kylon\n\n"
             << "Usage: " << QCoreApplication::applicationName() << " get <options>\n\n"
             << helpIndent(helpIndentLv1) << "help\n"
-            << helpIndent(helpIndentLv2) << "Show help.\n\n"
-            << helpIndent(helpIndentLv1) << dataPathArg << "\n"
-            << helpIndent(helpIndentLv2) << "Print CLI data path.\n\n"
-            << helpIndent(helpIndentLv1) << listDaemonsArg << "\n"
-            << helpIndent(helpIndentLv2) << "List saved daemons.\n\n"
-            << helpIndent(helpIndentLv1) << daemonSettArg << " " << daemonArg << "\n"
-            << helpIndent(helpIndentLv2) << "Request and print daemon settings.\n\n"
-            << helpIndent(helpIndentLv1) << deviceInfoArg << " " << daemonArg << "\n"
-            << helpIndent(helpIndentLv2) << "Request and print device info.\n\n"
-            << helpIndent(helpIndentLv1) << profilesArg << " " << daemonArg << "\n"
-            << helpIndent(helpIndentLv2) << "Request and print available profiles.\n\n"
-            << helpIndent(helpIndentLv1) << exportProfilesArg << " " << daemonArg << " <output path> <profile|all>\n"
-            << helpIndent(helpIndentLv2) << "Download a profile, or \"all\", to <output path>.\n\n"
-            << helpIndent(helpIndentLv1) << deviceDataArg << " " << daemonArg << "\n"
-            << helpIndent(helpIndentLv2) << "Request and print device data.\n\n"
-            << "\n"
-        ;
+            << helpIndent(helpIndentLv2) << "Show help.\n\n";
+
+        showCommandsHelp(ts, getCommands);
+        ts << "\n";
+    }
+
+    void CMDParser::showDeviceDataOptionsHelp(QTextStream &ts) const {
+        ts << helpIndent(helpIndentLv2) << "Options:\n"
+            << helpIndent(helpIndentLv3) << fieldsOpt << " <path,path..>\n"
+            << helpIndent(helpIndentLv4) << "Comma separated list of paths to print, other sections are not built.\n"
+            << helpIndent(helpIndentLv4) << "Path segments are separated by '.', use '*' to match any part of a key.\n"
+            << helpIndent(helpIndentLv4) << "Array items are matched by their position.\n"
+            << helpIndent(helpIndentLv4) << "Example: " << fieldsOpt << " linux.cpu_frequency.cpu_*.frequency,fan_control,intel.hwp_request.cpu_3\n\n"
+            << helpIndent(helpIndentLv3) << formatOpt << "=<json|csv|tsv>\n"
+            << helpIndent(helpIndentLv4) << "Output format, default is json.\n"
+            << helpIndent(helpIndentLv4) << "csv and tsv print a table with one row per CPU, or per GPU, and a header row.\n\n"
+            << helpIndent(helpIndentLv3) << tableOpt << "=<cpus|gpus>\n"
+            << helpIndent(helpIndentLv4) << "Table to print in csv or tsv format, default is cpus. Not accepted with json.\n\n"
+            << helpIndent(helpIndentLv3) << schemaOpt << "=<1|2>\n"
+            << helpIndent(helpIndentLv4) << "JSON output schema, default is 1. Not accepted with csv or tsv, as " << fieldsOpt << ".\n"
+            << helpIndent(helpIndentLv4) << "Schema 2 prints per core and per thread data as arrays indexed by CPU, instead of cpu_N keyed objects.\n"
+            << helpIndent(helpIndentLv4) << "Missing CPUs are null, " << fieldsOpt << " matches array items by position (intel.hwp_request.3).\n\n";
     }
 
     void CMDParser::showSetHelp() const {
@@ -576,16 +992,14 @@ namespace PWT::CLI {
         ts << "PowerTunerCLI v" << CLIENT_VER_MAJOR << "." << CLIENT_VER_MINOR << " - GPLv3 kylon\n\n"
             << "Usage: " << QCoreApplication::applicationName() << " set <options>\n\n"
             << helpIndent(helpIndentLv1) << "help\n"
-            << helpIndent(helpIndentLv2) << "Show help.\n\n"
-            << helpIndent(helpIndentLv1) << resetCliSettArg << "\n"
-            << helpIndent(helpIndentLv2) << "Reset CLI settings.\n\n"
-            << helpIndent(helpIndentLv1) << addDaemonsArg << " <name> <address> <port>\n"
-            << helpIndent(helpIndentLv2) << "List of daemons (name, address and port) to add to CLI.\n\n"
-            << helpIndent(helpIndentLv1) << removeDaemonsArg << " <name|address>\n"
-            << helpIndent(helpIndentLv2) << "List of space separated daemons to remove from CLI.\n\n"
-            << helpIndent(helpIndentLv1) << daemonSettArg << " " << daemonArg << " <setting=value>\n"
-            << helpIndent(helpIndentLv2) << "List of daemon settings, with their value, to set.\n\n"
-            << helpIndent(helpIndentLv2) << "Available settings:\n\n"
+            << helpIndent(helpIndentLv2) << "Show help.\n\n";
+
+        showCommandsHelp(ts, setCommands);
+        ts << "\n";
+    }
+
+    void CMDParser::showDaemonSettingsListHelp(QTextStream &ts) const {
+        ts << helpIndent(helpIndentLv2) << "Available settings:\n\n"
             << helpIndent(helpIndentLv3) << "start_profile\n"
             << helpIndent(helpIndentLv4) << "Profile to apply on daemon start.\n\n"
             << helpIndent(helpIndentLv3) << "battery_profile\n"
@@ -607,210 +1021,118 @@ namespace PWT::CLI {
             << helpIndent(helpIndentLv3) << "tcp_port\n"
             << helpIndent(helpIndentLv4) << "Daemon TCP port.\n\n"
             << helpIndent(helpIndentLv3) << "udp_port\n"
-            << helpIndent(helpIndentLv4) << "Daemon UDP port.\n\n"
-            << helpIndent(helpIndentLv1) << deleteProfileArg << " " << daemonArg << " <profile>\n"
-            << helpIndent(helpIndentLv2) << "Delete a profile from disk.\n\n"
-            << helpIndent(helpIndentLv1) << applyProfileArg << " " << daemonArg << " <profile>\n"
-            << helpIndent(helpIndentLv2) << "Apply settings from profile.\n\n"
-            << helpIndent(helpIndentLv1) << importProfilesArg << " " << daemonArg << " <profile>\n"
-            << helpIndent(helpIndentLv2) << "List of space separated paths to profiles to import.\n\n"
-            << helpIndent(helpIndentLv1) << deviceSettingsArg << " " << daemonArg << " <setting=value>\n"
-            << helpIndent(helpIndentLv2) << "List of device settings, with their value, to set.\n\n"
-            << helpIndent(helpIndentLv2) << "To set core/thread level settings, append the CPU index like this: setting[cpu]=value.\n"
+            << helpIndent(helpIndentLv4) << "Daemon UDP port.\n\n";
+    }
+
+    void CMDParser::showDeviceSettingsOptionsHelp(QTextStream &ts) const {
+        ts << helpIndent(helpIndentLv2) << "To set core/thread level settings, append the CPU index like this: setting[cpu]=value.\n"
             << helpIndent(helpIndentLv2) << "To set the same value to all cores/threads, use an empty index: setting[]=value.\n"
             << helpIndent(helpIndentLv2) << "To set GPU settings, append the GPU index like this: setting[idx]=value.\n"
             << helpIndent(helpIndentLv2) << "To set the same value to all GPUs where the setting applies, use an empty index: setting[]=value.\n"
+            << helpIndent(helpIndentLv2) << "CPU and GPU indexes also accept ranges and lists: setting[0-15,32-47]=value.\n"
+            << helpIndent(helpIndentLv2) << "Thread indexes also accept " << smtSiblingsSel << ", every thread of a core but the first one.\n"
+            << helpIndent(helpIndentLv2) << "It requires core IDs in device data, currently reported on Linux only.\n"
+            << helpIndent(helpIndentLv2) << "When the same index is set more than once, the last value wins.\n"
             << helpIndent(helpIndentLv2) << "To set fan settings, append the fan ID like this: setting[id]=value.\n"
             << helpIndent(helpIndentLv2) << "A range of possible values, where fixed, is provided in the form of [value1, value2..] or [min, max].\n"
             << helpIndent(helpIndentLv2) << "Settings not available in the target device will be ignored.\n\n"
             << helpIndent(helpIndentLv2) << "Print a list of supported settings with help command.\n\n"
-            << helpIndent(helpIndentLv2) << "Options:\n"
-            << helpIndent(helpIndentLv3) << makeProfileArg << " <profile name>\n"
-            << helpIndent(helpIndentLv4) << "Create a profile from current device settings.\n\n"
-            << "\n"
-        ;
+            << helpIndent(helpIndentLv2) << "Options:\n";
+
+        for (const CommandInfo &option: deviceSettingsOptions) {
+            ts << helpIndent(helpIndentLv3) << toQString(option.name);
+
+            if (!option.usage.empty())
+                ts << " " << toQString(option.usage);
+
+            ts << "\n";
+
+            for (const QString &line: toQString(option.help).split('\n'))
+                ts << helpIndent(helpIndentLv4) << line << "\n";
+
+            ts << "\n";
+        }
+
+        ts << helpIndent(helpIndentLv3) << fromOpt << " <file|->\n"
+            << helpIndent(helpIndentLv4) << "Read settings from a JSON file, or stdin with -.\n"
+            << helpIndent(helpIndentLv4) << "Keys are setting names, values are one of:\n"
+            << helpIndent(helpIndentLv5) << "a value, for global settings or to set all cores/threads/GPUs\n"
+            << helpIndent(helpIndentLv5) << "an array of values by index, null skips an index\n"
+            << helpIndent(helpIndentLv5) << "an object of index: value, indexes use the same syntax as setting[idx]\n"
+            << helpIndent(helpIndentLv4) << "Object indexes are applied in key order, settings after " << fromOpt << " override the file.\n"
+            << helpIndent(helpIndentLv4) << "Example: {\"cpu_max_freq\": {\"0-15\": 3000000}, \"cpu_status\": [1, 1, 0, 0], \"smt_state\": \"on\"}\n\n";
     }
 
-    void CMDParser::showLinuxSettingsListHelp() const {
+    void CMDParser::showSettingsGroupHelp(QTextStream &ts, const SettingGroup group, const char *title) const {
         const QString sendDataReqHelp = QString("Send %1 request for possible values.\n\n").arg(deviceDataArg);
+        const QString sendInfoReqHelp = QString("Send %1 request for input ranges.\n\n").arg(deviceInfoArg);
+
+        ts << title << ":\n";
+
+        for (const SettingInfo &setting: settingsSchema) {
+            if (setting.group != group || (!helpSettingsFilter.isEmpty() && !helpSettingsFilter.contains(toQString(setting.name))))
+                continue;
+
+            ts << helpIndent(helpIndentLv1) << toQString(setting.name) << "\n";
+
+            if (setting.scope == SettingScope::Thread)
+                ts << helpIndent(helpIndentLv2) << "Thread level setting.\n";
+            else if (setting.scope == SettingScope::Core)
+                ts << helpIndent(helpIndentLv2) << "Core level setting.\n";
+
+            for (const QString &line: toQString(setting.help).split('\n')) {
+                if (line.isEmpty())
+                    ts << "\n";
+                else if (line.front() == '\t')
+                    ts << helpIndent(helpIndentLv3) << line.sliced(1) << "\n";
+                else
+                    ts << helpIndent(helpIndentLv2) << line << "\n";
+            }
+
+            switch (setting.hint) {
+                case SettingHint::DataRequest:
+                    ts << helpIndent(helpIndentLv2) << sendDataReqHelp;
+                    break;
+                case SettingHint::InfoRequest:
+                    ts << helpIndent(helpIndentLv2) << sendInfoReqHelp;
+                    break;
+                default:
+                    ts << "\n";
+                    break;
+            }
+        }
+    }
+
+    void CMDParser::showLinuxSettingsListHelp() const {
         QTextStream ts(stdout);
 
         ts.setFieldAlignment(QTextStream::AlignLeft);
 
-        ts << "Sysfs:\n"
-            << helpIndent(helpIndentLv1) << smtStateArg << "\n"
-            << helpIndent(helpIndentLv2) << "Simultaneous Multi-Threading / Hyper-Threading. [on, off, forceoff]\n\n"
-            << helpIndent(helpIndentLv1) << cpuIdleGovernorArg << "\n"
-            << helpIndent(helpIndentLv2) << "CPU Idle Governor.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << blockDevQueSchedArg << "\n"
-            << helpIndent(helpIndentLv2) << "Block device queue scheduler.\n"
-            << helpIndent(helpIndentLv2) << "Usage: " << blockDevQueSchedArg << "[device]=scheduler.\n"
-            << helpIndent(helpIndentLv2) << "Example: \"" << blockDevQueSchedArg << "[sda]\"=mq-deadline.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << miscPmDevsArg << "\n"
-            << helpIndent(helpIndentLv2) << "Devices power management mode. [auto, on]\n"
-            << helpIndent(helpIndentLv2) << "Usage: " << miscPmDevsArg << "[control path]=mode.\n"
-            << helpIndent(helpIndentLv2) << "Example: \"" << miscPmDevsArg << "[/sys/bus/usb/devices/2-1/power/control]\"=auto.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << cpuMinFreqArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "CPU minimum frequency.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << cpuMaxFreqArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "CPU maximum frequency.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << cpuScalingGovernorArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "CPU scaling governor.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << cpuStatusArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "CPU online status. [0,1]\n\n"
-            << "Intel GPUs:\n"
-            << helpIndent(helpIndentLv1) << gpuRpsMinFreqArg << "\n"
-            << helpIndent(helpIndentLv2) << "GPU minimum frequency.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << gpuRpsMaxFreqArg << "\n"
-            << helpIndent(helpIndentLv2) << "GPU maximum frequency.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << gpuRpsMaxBoostArg << "\n"
-            << helpIndent(helpIndentLv2) << "GPU maximum boost frequency.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << "AMD GPUs:\n"
-            << helpIndent(helpIndentLv1) << powerDpmStateArg << "\n"
-            << helpIndent(helpIndentLv2) << "Legacy power DPM state. [battery, balanced, performance]\n\n"
-            << helpIndent(helpIndentLv1) << powerDpmForcePerfLvlArg << "\n"
-            << helpIndent(helpIndentLv2) << "Power DPM force performance level.\n"
-            << helpIndent(helpIndentLv2) << "[auto, low, high, manual, profile_standard, profile_min_sclk, profile_min_mclk, profile_peak]\n\n"
-            << helpIndent(helpIndentLv1) << powerDpmForcePerfMinSclkArg << "\n"
-            << helpIndent(helpIndentLv2) << "GPU minimum sclk. Requires power_dpm_force_perf_level=manual.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << powerDpmForcePerfMaxSclkArg << "\n"
-            << helpIndent(helpIndentLv2) << "GPU maximum sclk. Requires power_dpm_force_perf_level=manual.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << powerDpmForcePerfResetArg << "\n"
-            << helpIndent(helpIndentLv2) << "Perform DPM performance level settings reset. [0,1]\n\n";
+        showSettingsGroupHelp(ts, SettingGroup::LinuxSysfs, "Sysfs");
+        showSettingsGroupHelp(ts, SettingGroup::LinuxIntelGPU, "Intel GPUs");
+        showSettingsGroupHelp(ts, SettingGroup::LinuxAMDGPU, "AMD GPUs");
     }
 #ifdef WITH_AMD
     void CMDParser::showLinuxAMDSettingsListHelp() const {
-        const QString sendDataReqHelp = QString("Send %1 request for possible values.\n\n").arg(deviceDataArg);
         QTextStream ts(stdout);
 
         ts.setFieldAlignment(QTextStream::AlignLeft);
 
-        ts << "AMD CPUs:\n"
-            << helpIndent(helpIndentLv1) << pstateStatusArg << "\n"
-            << helpIndent(helpIndentLv2) << "AMD PState Scaling Driver status. [disable, active, passive, guided]\n\n"
-            << helpIndent(helpIndentLv1) << pstateEppArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "Requires pstate_status=active\n"
-            << helpIndent(helpIndentLv2) << "AMD PState Scaling Driver energy performance preference.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp;
+        showSettingsGroupHelp(ts, SettingGroup::LinuxAMD, "AMD CPUs");
     }
 
     void CMDParser::showAMDCPUSettingsListHelp() const {
-        const QString sendDataReqHelp = QString("Send %1 request for possible values.\n\n").arg(deviceDataArg);
-        const QString sendInfoReqHelp = QString("Send %1 request for input ranges.\n\n").arg(deviceInfoArg);
         QTextStream ts(stdout);
 
         ts.setFieldAlignment(QTextStream::AlignLeft);
 
-        ts << "AMD CPUs:\n"
-            << helpIndent(helpIndentLv1) << stapmLimitArg << "\n"
-            << helpIndent(helpIndentLv2) << "Skin temperature-aware power management limit (STAPM).\n"
-            << helpIndent(helpIndentLv2) << "Sustained power limit (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << fastLimitArg << "\n"
-            << helpIndent(helpIndentLv2) << "Package power tracking fast limit (PPT fast).\n"
-            << helpIndent(helpIndentLv2) << "Actual power limit (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << slowLimitArg << "\n"
-            << helpIndent(helpIndentLv2) << "Package power tracking slow limit (PPT slow).\n"
-            << helpIndent(helpIndentLv2) << "Average power limit (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << tctlTempArg << "\n"
-            << helpIndent(helpIndentLv2) << "T control temperature (TCTL).\n"
-            << helpIndent(helpIndentLv2) << "Thermal limit core (celsius).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << apuSlowArg << "\n"
-            << helpIndent(helpIndentLv2) << "Package power tracking APU slow limit (PPT APU).\n"
-            << helpIndent(helpIndentLv2) << "APU slow power limit for A+A dGPU platform (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << apuSkinTempArg << "\n"
-            << helpIndent(helpIndentLv2) << "Smart temperature tracking APU (STT APU).\n"
-            << helpIndent(helpIndentLv2) << "APU skin temperature limit (celsius).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << dgpuSkinTempArg << "\n"
-            << helpIndent(helpIndentLv2) << "Smart temperature tracking dGPU (STT dGPU).\n"
-            << helpIndent(helpIndentLv2) << "dGPU skin temperature limit (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << curveOptimizerArg << "\n"
-            << helpIndent(helpIndentLv2) << "Curve optimizer offset (All cores).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << curveOptimizerPerArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "Curve optimizer offset.\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << vrmCurrentArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thermal Design Current Limit (TDC VDD).\n"
-            << helpIndent(helpIndentLv2) << "VRM current limit (amps).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << vrmSocCurrentArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thermal Design Current Limit (TDC SoC).\n"
-            << helpIndent(helpIndentLv2) << "VRM SoC current limit (amps).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << vrmMaxCurrentArg << "\n"
-            << helpIndent(helpIndentLv2) << "Electrical Design Current Limit (EDC VDD).\n"
-            << helpIndent(helpIndentLv2) << "VRM maximum current limit (amps).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << vrmSocMaxCurrentArg << "\n"
-            << helpIndent(helpIndentLv2) << "Electrical Design Current Limit (EDC SoC).\n"
-            << helpIndent(helpIndentLv2) << "VRM SoC maximum current limit (amps).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << staticGfxClkArg << "\n"
-            << helpIndent(helpIndentLv2) << "Force static GPU clock (MHz).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << minGfxClkArg << "\n"
-            << helpIndent(helpIndentLv2) << "Maximum GPU clock (MHz).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << maxGfxClkArg << "\n"
-            << helpIndent(helpIndentLv2) << "Minimum GPU clock (MHz).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << amdPowerProfileArg << "\n"
-            << helpIndent(helpIndentLv2) << "Power profile. [0 = powersave, 1 = performance]\n"
-            << helpIndent(helpIndentLv2) << "Hidden option to improve power saving or performance.\n"
-            << helpIndent(helpIndentLv2) << "Behavior depends on CPU, device and manufacturer.\n\n"
-            << helpIndent(helpIndentLv1) << corePerfBoostArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "Disable core performance boost. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pstateCmdArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "CPU P-State control.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << cppcEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable CPPC. [1,1]\n\n"
-            << helpIndent(helpIndentLv1) << cppcRequestMinPerfArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "CPPC request minimum performance.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << cppcRequestMaxPerfArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "CPPC request maximum performance.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << cppcRequestDesiredPerfArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "CPPC request desired performance.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << cppcRequestEppArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "CPPC request energy performance preference. [0, 255]\n\n";
+        showSettingsGroupHelp(ts, SettingGroup::AMDCPU, "AMD CPUs");
     }
 #endif
 
     void CMDParser::showWindowsSettingsListHelp() const {
         const QString sendDataReqHelp = QString("Send %1 request for possible values.\n\n").arg(deviceDataArg);
+        const QString powerSchemeArg = settingName(Setting::PowerScheme);
         QTextStream ts(stdout);
 
         ts.setFieldAlignment(QTextStream::AlignLeft);
@@ -818,282 +1140,34 @@ namespace PWT::CLI {
         ts << "Windows:\n"
             << helpIndent(helpIndentLv1) << "Power schemes:\n"
             << helpIndent(helpIndentLv2) << powerSchemeArg << "\n"
-            << helpIndent(helpIndentLv3) << "Windows power scheme setting.\n\n"
+            << helpIndent(helpIndentLv3) << toQString(getSettingInfo(Setting::PowerScheme).help) << "\n\n"
             << helpIndent(helpIndentLv3) << "Usage: " << powerSchemeArg << "[scheme GUID;setting GUID;mode]\n"
             << helpIndent(helpIndentLv3) << "Example: \"" << powerSchemeArg << "[10401140-123-41f0-iofd-dd5bb2g0dhge;381b4222-f694-41f0-9685-ff5bb260df2e;ac]\"=10\n"
             << helpIndent(helpIndentLv3) << sendDataReqHelp
-            << helpIndent(helpIndentLv2) << "Options:\n"
-            << helpIndent(helpIndentLv3) << winPsResetDefaultsArg << "\n"
-            << helpIndent(helpIndentLv4) << "Reset power schemes to default before applying settings.\n\n"
-            << helpIndent(helpIndentLv3) << winPsReplaceDefaultsArg << "\n"
-            << helpIndent(helpIndentLv4) << "Replace default power schemes with current schemes after apply.\n\n"
-            << helpIndent(helpIndentLv3) << winPsActiveSchemeArg << " <scheme GUID>\n"
-            << helpIndent(helpIndentLv4) << "Set the active power scheme.\n\n"
-            << helpIndent(helpIndentLv3) << winPsDeleteSchemesArg << " <scheme GUID>\n"
-            << helpIndent(helpIndentLv4) << "Comma separated list of power schemes to delete.\n\n"
-            << helpIndent(helpIndentLv3) << winPsResetSchemesArg << " <scheme GUID>\n"
-            << helpIndent(helpIndentLv4) << "Comma separated list of power schemes to reset to defaults from default user schemes stored in HKEY_USERS\\.Default.\n\n"
-            << helpIndent(helpIndentLv3) << winPsCopySchemeSettingsArg << " <from scheme GUID> <from mode> <to scheme GUID> <to mode>\n"
-            << helpIndent(helpIndentLv4) << "Copy all settings from one scheme to another.\n"
-            << helpIndent(helpIndentLv4) << "<from mode> valid values: ac, dc.\n"
-            << helpIndent(helpIndentLv4) << "<to mode> valid values: ac, dc, all.\n"
-            << helpIndent(helpIndentLv4) << "Copy command is run before " << powerSchemeArg << " and after " << winPsDuplicateSchemeArg << ".\n\n"
-            << helpIndent(helpIndentLv3) << winPsDuplicateSchemeArg << " <base scheme GUID> <scheme name> <temp scheme handle>\n"
-            << helpIndent(helpIndentLv4) << "Create a new power scheme based on <base scheme GUID>.\n"
-            << helpIndent(helpIndentLv4) << "<temp scheme handle> is a string you can use, in place of its GUID, to set its settings.\n"
-            << helpIndent(helpIndentLv4) << "<temp scheme handle> allowed characters: [a-z0-9_-].\n"
-            << helpIndent(helpIndentLv4) << "Duplicate command is run before " << powerSchemeArg << ".\n\n";
+            << helpIndent(helpIndentLv2) << "Options:\n";
+
+        for (const CommandInfo &option: windowsSchemesOptions) {
+            ts << helpIndent(helpIndentLv3) << toQString(option.name);
+
+            if (!option.usage.empty())
+                ts << " " << toQString(option.usage);
+
+            ts << "\n";
+
+            for (const QString &line: toQString(option.help).split('\n'))
+                ts << helpIndent(helpIndentLv4) << line << "\n";
+
+            ts << "\n";
+        }
     }
 
 #ifdef WITH_INTEL
     void CMDParser::showIntelCPUSettingsListHelp() const {
-        const QString sendDataReqHelp = QString("Send %1 request for possible values.\n\n").arg(deviceDataArg);
-        const QString sendInfoReqHelp = QString("Send %1 request for input ranges.\n\n").arg(deviceInfoArg);
         QTextStream ts(stdout);
 
         ts.setFieldAlignment(QTextStream::AlignLeft);
 
-        ts << "Intel CPUs:\n"
-            << helpIndent(helpIndentLv1) << pkgLimitPl1Arg << "\n"
-            << helpIndent(helpIndentLv2) << "PKG power limit PL1 (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << pkgLimitPl2Arg << "\n"
-            << helpIndent(helpIndentLv2) << "PKG power limit PL2 (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << pkgLimitPl1TimeArg << "\n"
-            << helpIndent(helpIndentLv2) << "PKG power limit PL1 time window. [0, 56000]\n\n"
-            << helpIndent(helpIndentLv1) << pkgLimitPl2TimeArg << "\n"
-            << helpIndent(helpIndentLv2) << "PKG power limit PL2 time window. [0, 56000]\n\n"
-            << helpIndent(helpIndentLv1) << pkgLimitPl1ClampArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable value clamp for PKG power limit PL1. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgLimitPl2ClampArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable value clamp for PKG power limit PL2. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgLimitPl1EnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable PKG power limit PL1. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgLimitPl2EnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable PKG power limit PL2. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgLimitLockArg << "\n"
-            << helpIndent(helpIndentLv2) << "Lock PKG power limit register until device reboot. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << vrCurrentCfgPl4Arg << "\n"
-            << helpIndent(helpIndentLv2) << "VR current config limit PL4 (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << vrCurrentCfgLockArg << "\n"
-            << helpIndent(helpIndentLv2) << "Lock VR current config register until device reboot. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pp1CurrentLimitArg << "\n"
-            << helpIndent(helpIndentLv2) << "Graphics current config (PP1) limit (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << pp1CurrentLockArg << "\n"
-            << helpIndent(helpIndentLv2) << "Lock graphics current config (PP1) register until device reboot. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << turboPwrCurrentTdpArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo power current TDP limit (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << turboPwrCurrentTdpEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable turbo power current TDP limit. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << turboPwrCurrentTdcArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo power current TDC limit (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << turboPwrCurrentTdcEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable turbo power current TDC limit. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << turboRatioLimit1cArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo ratio limit for 1 core. [1, 255]\n\n"
-            << helpIndent(helpIndentLv1) << turboRatioLimit2cArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo ratio limit for 2 cores. [1, 255]\n\n"
-            << helpIndent(helpIndentLv1) << turboRatioLimit3cArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo ratio limit for 3 cores. [1, 255]\n\n"
-            << helpIndent(helpIndentLv1) << turboRatioLimit4cArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo ratio limit for 4 cores. [1, 255]\n\n"
-            << helpIndent(helpIndentLv1) << turboRatioLimit5cArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo ratio limit for 5 cores. [1, 255]\n\n"
-            << helpIndent(helpIndentLv1) << turboRatioLimit6cArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo ratio limit for 6 cores. [1, 255]\n\n"
-            << helpIndent(helpIndentLv1) << turboRatioLimit7cArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo ratio limit for 7 cores. [1, 255]\n\n"
-            << helpIndent(helpIndentLv1) << turboRatioLimit8cArg << "\n"
-            << helpIndent(helpIndentLv2) << "Turbo ratio limit for 8 cores. [1, 255]\n\n"
-            << helpIndent(helpIndentLv1) << enhancedSpeedstepEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable CPU enhanced speedstep technology. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << turboModeDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable CPU turbo boost. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << bdProchotEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable Bi-Directional PROCHOT. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << c1eEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable C1 Enhanced (C1E). [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << sapmImcC2PolicyArg << "\n"
-            << helpIndent(helpIndentLv2) << "Allow self-refresh in package C2 state. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << fastBrkSnpEnArg << "\n"
-            << helpIndent(helpIndentLv2) << "Use fast VID swing rate. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << powerPerformancePlatformOverrideArg << "\n"
-            << helpIndent(helpIndentLv2) << "Power performance platform override. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << energyEfficiencyOptDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable energy efficiency optimization. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << raceToHaltDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable race to halt optimization. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << prochotOutputDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable PROCHOT output. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << prochotCfgResponseEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable PROCHOT configurable response. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << vrThermAlertDisableLockArg << "\n"
-            << helpIndent(helpIndentLv2) << "Lock PROCHOT bits until device reboot. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << vrThermAlertDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable VR_THERMAL_ALERT signaling. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << ringEEDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable ring EE. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << saOptDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable SA optimization. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << ookDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable OOK. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << hwpAutonomousDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable HWP autonomous mode. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << cstatePrewakeDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable C-state pre-wake. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << eistDisableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Disable EIST (Enhanced SpeedStep) hardware coordination. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pp0PriorityArg << "\n"
-            << helpIndent(helpIndentLv2) << "CPU power balance. [0, 31]\n\n"
-            << helpIndent(helpIndentLv1) << pp1PriorityArg << "\n"
-            << helpIndent(helpIndentLv2) << "GPU power balance. [0, 31]\n\n"
-            << helpIndent(helpIndentLv1) << energyPerfBiasArg << "\n"
-            << helpIndent(helpIndentLv2) << "Performance Energy Bias Hint. [0, 15]\n\n"
-            << helpIndent(helpIndentLv1) << uvControlCpuArg << "\n"
-            << helpIndent(helpIndentLv2) << "CPU undervolt offset.\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << uvControlGpuArg << "\n"
-            << helpIndent(helpIndentLv2) << "GPU undervolt offset.\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << uvControlCacheArg << "\n"
-            << helpIndent(helpIndentLv2) << "Cache undervolt offset.\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << uvControlUnsliceArg << "\n"
-            << helpIndent(helpIndentLv2) << "Unslice undervolt offset.\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << uvControlSaArg << "\n"
-            << helpIndent(helpIndentLv2) << "SysAgent undervolt offset.\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << hwpEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable HWP. [1,1]\n\n"
-            << helpIndent(helpIndentLv1) << hwpPkgCtlPolarityEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Enable HWP pkg ctl polarity. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestPkgMinPerfArg << "\n"
-            << helpIndent(helpIndentLv2) << "HWP request pkg minimum performance.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << hwpRequestPkgMaxPerfArg << "\n"
-            << helpIndent(helpIndentLv2) << "HWP request pkg maximum performance.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << hwpRequestPkgDesiredPerfArg << "\n"
-            << helpIndent(helpIndentLv2) << "HWP request pkg desired performance.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << hwpRequestPkgEppArg << "\n"
-            << helpIndent(helpIndentLv2) << "HWP request pkg energy performance preference. [0, 255]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestPkgAcwArg << "\n"
-            << helpIndent(helpIndentLv2) << "HWP request pkg activity window. [0, 127000]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestMinPerfArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request minimum performance.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << hwpRequestMaxPerfArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request maximum performance.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << hwpRequestDesiredPerfArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request desired performance.\n"
-            << helpIndent(helpIndentLv2) << sendDataReqHelp
-            << helpIndent(helpIndentLv1) << hwpRequestEppArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request energy performance preference. [0, 255]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestAcwArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request activity window. [0, 127000]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestPkgControlArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request package control flag. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestMinValidArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request minimum performance validity. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestMaxValidArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request maximum performance validity. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestDesiredValidArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request desired performance validity. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestEppValidArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request energy performance preference validity. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << hwpRequestAcwValidArg << "\n"
-            << helpIndent(helpIndentLv2) << "Thread level setting.\n"
-            << helpIndent(helpIndentLv2) << "HWP request activity window validity. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlCstateLimArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "C-State configuration control package C-State limit.\n\n"
-            << helpIndent(helpIndentLv2) << "sandy/ivy bridge possible values:\n"
-            << helpIndent(helpIndentLv3) << "[0] C0/C1 (no package C-sate support)\n"
-            << helpIndent(helpIndentLv3) << "[1] C2\n"
-            << helpIndent(helpIndentLv3) << "[2] C6 no retention\n"
-            << helpIndent(helpIndentLv3) << "[3] C6 retention\n"
-            << helpIndent(helpIndentLv3) << "[4] C7\n"
-            << helpIndent(helpIndentLv3) << "[5] C7s\n"
-            << helpIndent(helpIndentLv3) << "[7] No package C-state limit\n\n"
-            << helpIndent(helpIndentLv2) << "core ultra series possible values:\n"
-            << helpIndent(helpIndentLv3) << "[0] C0/C1 (no package C-sate support)\n"
-            << helpIndent(helpIndentLv3) << "[1] C2\n"
-            << helpIndent(helpIndentLv3) << "[2] C3\n"
-            << helpIndent(helpIndentLv3) << "[3] C6\n"
-            << helpIndent(helpIndentLv3) << "[4] C7\n"
-            << helpIndent(helpIndentLv3) << "[5] C7s\n"
-            << helpIndent(helpIndentLv3) << "[6] C8\n"
-            << helpIndent(helpIndentLv3) << "[7] C9\n"
-            << helpIndent(helpIndentLv3) << "[8] C10\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlMaxCoreCstateArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "Max core C-State.\n"
-            << helpIndent(helpIndentLv2) << "core ultra series possible values:\n"
-            << helpIndent(helpIndentLv3) << "[1] C1\n"
-            << helpIndent(helpIndentLv3) << "[2] C3\n"
-            << helpIndent(helpIndentLv3) << "[3] C6\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlIOMWaitRedirectEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "I/O MWAIT redirect enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlCfgLockArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "Lock C-State limit and I/O MWAIT redirection settings until device reboot. [1,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlC3StateAutodemotionEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "C3 state auto-demotion enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlC1StateAutodemotionEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "C1 state auto-demotion enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlC3UndemotionEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "C3 un-demotion enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlC1UndemotionEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "C1 un-demotion enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlPkgcAutodemotionEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "Package C-State auto-demotion enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlPkgcUndemotionEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "Package C-State un-demotion enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgCstCfgControlTimedMwaitEnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "Core level setting.\n"
-            << helpIndent(helpIndentLv2) << "Timed MWAIT feature enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgRaplPl1Arg << "\n"
-            << helpIndent(helpIndentLv2) << "MCHBAR package power limit PL1 (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << pkgRaplPl2Arg << "\n"
-            << helpIndent(helpIndentLv2) << "MCHBAR package power limit PL2 (watts).\n"
-            << helpIndent(helpIndentLv2) << sendInfoReqHelp
-            << helpIndent(helpIndentLv1) << pkgRaplPl1EnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "MCHBAR package power limit PL1 enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgRaplPl2EnableArg << "\n"
-            << helpIndent(helpIndentLv2) << "MCHBAR package power limit PL2 enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgRaplPl1ClampArg << "\n"
-            << helpIndent(helpIndentLv2) << "MCHBAR package power limit PL1 clamp enable. [0,1]\n\n"
-            << helpIndent(helpIndentLv1) << pkgRaplPl1TimeArg << "\n"
-            << helpIndent(helpIndentLv2) << "MCHBAR package power limit PL1 time window. [0, 56000]\n\n"
-            << helpIndent(helpIndentLv1) << pkgRaplLockArg << "\n"
-            << helpIndent(helpIndentLv2) << "Lock MCHBAR package power limit register until device reboot. [0,1]\n\n"
-        ;
+        showSettingsGroupHelp(ts, SettingGroup::IntelCPU, "Intel CPUs");
     }
 #endif
 
@@ -1102,16 +1176,233 @@ namespace PWT::CLI {
 
         ts.setFieldAlignment(QTextStream::AlignLeft);
 
-        ts << "Fan control:\n"
-            << helpIndent(helpIndentLv1) << fanModeArg << "\n"
-            << helpIndent(helpIndentLv2) << "Fan mode. [0=auto, 1=manual]\n\n"
-            << helpIndent(helpIndentLv1) << fanTripPointArg << "\n"
-            << helpIndent(helpIndentLv2) << "Fan temperature trip point. Requires fan_mode[id]=1.\n"
-            << helpIndent(helpIndentLv2) << "Define more than one trip point to create a curve.\n"
-            << helpIndent(helpIndentLv2) << "To set a fixed fan speed, provide only one trip point with no temperature.\n\n"
-            << helpIndent(helpIndentLv2) << "Usage: \"" << fanTripPointArg << "[id:temperature_celsius]=speed_percent\".\n"
-            << helpIndent(helpIndentLv2) << "Usage (fixed speed): \"" << fanTripPointArg << "[id]=speed_percent\".\n"
-            << helpIndent(helpIndentLv2) << "Example: \"" << fanTripPointArg << "[3hd907:40]=25\".\n\n"
-        ;
+        showSettingsGroupHelp(ts, SettingGroup::FanControl, "Fan control");
+    }
+
+    QList<QString> CMDParser::getHelpOptions() const {
+        return {
+            helpLinuxSettingsArg,
+            helpWindowsSettingsArg,
+#ifdef WITH_AMD
+            helpLinuxAMDSettingsArg,
+            helpAMDCPUSettingsArg,
+#endif
+#ifdef WITH_INTEL
+            helpIntelCPUSettingsArg,
+#endif
+            helpFanControlSettingsArg,
+            helpBashCompletionArg,
+            helpZshCompletionArg,
+            helpFishCompletionArg
+        };
+    }
+
+    QList<QString> CMDParser::getDeviceSettingsOptions() const {
+        QList<QString> options;
+
+        for (const CommandInfo &option: deviceSettingsOptions)
+            options.append(toQString(option.name));
+
+        for (const CommandInfo &option: windowsSchemesOptions)
+            options.append(toQString(option.name));
+
+        options.append(fromOpt);
+        return options;
+    }
+
+    QString CMDParser::getCompletionCachePath() const {
+        const QString path = completionCache.getPath();
+
+        // same location used by QStandardPaths on linux
+        if (path.isEmpty())
+            return QStringLiteral("${XDG_DATA_HOME:-$HOME/.local/share}/PowerTuner/cli/completion");
+
+        return path;
+    }
+
+    // completion scripts only read the cache file written by device-data and device-settings,
+    // without a cache for the daemon all settings are offered
+
+    void CMDParser::showBashCompletion() const {
+        const QString appName = QCoreApplication::applicationName();
+        QList<QString> getCmds;
+        QList<QString> setCmds;
+        QList<QString> settings;
+        QTextStream ts(stdout);
+
+        for (const CommandInfo &cmd: getCommands)
+            getCmds.append(toQString(cmd.name));
+
+        for (const CommandInfo &cmd: setCommands)
+            setCmds.append(toQString(cmd.name));
+
+        for (const SettingInfo &setting: settingsSchema)
+            settings.append(toQString(setting.name) + (setting.scope == SettingScope::Global ? "=" : "["));
+
+        // source the output, or save it in the bash-completion directory
+        ts << "_" << appName << "() {\n"
+            << "    local cache=\"" << getCompletionCachePath() << "\" settings=\"" << settings.join(' ') << "\"\n"
+            << "    local line=${COMP_LINE:0:COMP_POINT} mode=\"\" cmd=\"\" daemon=\"\" values=\"\" words cur name key vals i\n"
+            << "    read -ra words <<< \"$line\"\n"
+            << "    [[ -z $line || $line == *[[:space:]] ]] && words+=(\"\")\n"
+            << "    cur=${words[-1]}\n"
+            << "    for ((i=1; i<${#words[@]}-1; ++i)); do\n"
+            << "        case ${words[i]} in\n"
+            << "            " << outputOpt << ") ((++i)) ;;\n"
+            << "            --*) ;;\n"
+            << "            *) if [[ -z $mode ]]; then mode=${words[i]}; elif [[ -z $cmd ]]; then cmd=${words[i]}; elif [[ -z $daemon ]]; then daemon=${words[i]}; fi ;;\n"
+            << "        esac\n"
+            << "    done\n"
+            << "    case $mode in\n"
+            << "        \"\") COMPREPLY=($(compgen -W \"" << getArg << " " << setArg << " " << helpArg << " " << outputOpt << " " << compressOpt << "=\" -- \"$cur\")) ;;\n"
+            << "        " << getArg << ") [[ -z $cmd ]] && COMPREPLY=($(compgen -W \"" << getCmds.join(' ') << "\" -- \"$cur\")) ;;\n"
+            << "        " << setArg << ")\n"
+            << "            if [[ -z $cmd ]]; then\n"
+            << "                COMPREPLY=($(compgen -W \"" << setCmds.join(' ') << "\" -- \"$cur\"))\n"
+            << "            elif [[ $cmd == " << deviceSettingsArg << " && -z $daemon ]]; then\n"
+            << "                COMPREPLY=($(compgen -f -- \"$cache/$cur\"))\n"
+            << "                COMPREPLY=(\"${COMPREPLY[@]##*/}\")\n"
+            << "            elif [[ $cmd == " << deviceSettingsArg << " ]]; then\n"
+            << "                name=${cur%%=*}\n"
+            << "                name=${name%%\\[*}\n"
+            << "                if [[ -r $cache/$daemon ]]; then\n"
+            << "                    while read -r key vals; do\n"
+            << "                        if [[ $key == settings ]]; then settings=$vals; elif [[ $key == \"$name\" ]]; then values=$vals; fi\n"
+            << "                    done < \"$cache/$daemon\"\n"
+            << "                fi\n"
+            << "                if [[ $cur == *=* ]]; then\n"
+            << "                    COMPREPLY=($(compgen -W \"$values\" -- \"${cur#*=}\"))\n"
+            << "                else\n"
+            << "                    compopt -o nospace\n"
+            << "                    COMPREPLY=($(compgen -W \"" << getDeviceSettingsOptions().join(' ') << " $settings\" -- \"$cur\"))\n"
+            << "                fi\n"
+            << "            fi ;;\n"
+            << "        " << helpArg << ") [[ -z $cmd ]] && COMPREPLY=($(compgen -W \"" << getHelpOptions().join(' ') << "\" -- \"$cur\")) ;;\n"
+            << "    esac\n"
+            << "}\n"
+            << "complete -F _" << appName << " " << appName << "\n";
+    }
+
+    void CMDParser::showZshCompletion() const {
+        const QString appName = QCoreApplication::applicationName();
+        QList<QString> getCmds;
+        QList<QString> setCmds;
+        QList<QString> settings;
+        QTextStream ts(stdout);
+
+        for (const CommandInfo &cmd: getCommands)
+            getCmds.append(toQString(cmd.name));
+
+        for (const CommandInfo &cmd: setCommands)
+            setCmds.append(toQString(cmd.name));
+
+        for (const SettingInfo &setting: settingsSchema)
+            settings.append(toQString(setting.name) + (setting.scope == SettingScope::Global ? "=" : "["));
+
+        // save the output as _<app name> in a $fpath directory
+        ts << "#compdef " << appName << "\n"
+            << "local cache=\"" << getCompletionCachePath() << "\" settings=\"" << settings.join(' ') << "\"\n"
+            << "local mode=\"\" cmd=\"\" daemon=\"\" values=\"\" cur=${words[CURRENT]} name key vals i\n"
+            << "for ((i=2; i<CURRENT; ++i)); do\n"
+            << "    case ${words[i]} in\n"
+            << "        " << outputOpt << ") ((++i)) ;;\n"
+            << "        --*) ;;\n"
+            << "        *) if [[ -z $mode ]]; then mode=${words[i]}; elif [[ -z $cmd ]]; then cmd=${words[i]}; elif [[ -z $daemon ]]; then daemon=${words[i]}; fi ;;\n"
+            << "    esac\n"
+            << "done\n"
+            << "case $mode in\n"
+            << "    \"\") compadd -- " << getArg << " " << setArg << " " << helpArg << " " << outputOpt << "; compadd -S '' -- " << compressOpt << "= ;;\n"
+            << "    " << getArg << ") [[ -z $cmd ]] && compadd -- " << getCmds.join(' ') << " ;;\n"
+            << "    " << setArg << ")\n"
+            << "        if [[ -z $cmd ]]; then\n"
+            << "            compadd -- " << setCmds.join(' ') << "\n"
+            << "        elif [[ $cmd == " << deviceSettingsArg << " && -z $daemon ]]; then\n"
+            << "            compadd -- \"$cache\"/*(N:t)\n"
+            << "        elif [[ $cmd == " << deviceSettingsArg << " ]]; then\n"
+            << "            name=${cur%%=*}\n"
+            << "            name=${name%%\\[*}\n"
+            << "            if [[ -r $cache/$daemon ]]; then\n"
+            << "                while read -r key vals; do\n"
+            << "                    if [[ $key == settings ]]; then settings=$vals; elif [[ $key == \"$name\" ]]; then values=$vals; fi\n"
+            << "                done < \"$cache/$daemon\"\n"
+            << "            fi\n"
+            << "            if [[ $cur == *=* ]]; then\n"
+            << "                compset -P '*='\n"
+            << "                compadd -- ${=values}\n"
+            << "            else\n"
+            << "                compadd -- " << getDeviceSettingsOptions().join(' ') << "\n"
+            << "                compadd -S '' -- ${=settings}\n"
+            << "            fi\n"
+            << "        fi ;;\n"
+            << "    " << helpArg << ") [[ -z $cmd ]] && compadd -- " << getHelpOptions().join(' ') << " ;;\n"
+            << "esac\n";
+    }
+
+    void CMDParser::showFishCompletion() const {
+        const QString appName = QCoreApplication::applicationName();
+        const QString fnName = QString("__%1_complete").arg(appName);
+        QList<QString> getCmds;
+        QList<QString> setCmds;
+        QList<QString> settings;
+        QTextStream ts(stdout);
+
+        for (const CommandInfo &cmd: getCommands)
+            getCmds.append(toQString(cmd.name));
+
+        for (const CommandInfo &cmd: setCommands)
+            setCmds.append(toQString(cmd.name));
+
+        for (const SettingInfo &setting: settingsSchema)
+            settings.append(toQString(setting.name) + (setting.scope == SettingScope::Global ? "=" : "["));
+
+        // save the output as <app name>.fish in ~/.config/fish/completions
+        ts << "function " << fnName << "\n"
+            << "    set -l cache \"" << getCompletionCachePath() << "\"\n"
+            << "    set -l settings " << settings.join(' ') << "\n"
+            << "    set -l cur (commandline -ct)\n"
+            << "    set -l mode; set -l cmd; set -l daemon; set -l values; set -l skip 0\n"
+            << "    for tok in (commandline -opc)[2..-1]\n"
+            << "        if test $skip = 1; set skip 0; continue; end\n"
+            << "        switch $tok\n"
+            << "            case " << outputOpt << "; set skip 1\n"
+            << "            case '--*'\n"
+            << "            case '*'\n"
+            << "                if test -z \"$mode\"; set mode $tok\n"
+            << "                else if test -z \"$cmd\"; set cmd $tok\n"
+            << "                else if test -z \"$daemon\"; set daemon $tok\n"
+            << "                end\n"
+            << "        end\n"
+            << "    end\n"
+            << "    switch \"$mode\"\n"
+            << "        case ''\n"
+            << "            printf '%s\\n' " << getArg << " " << setArg << " " << helpArg << " " << outputOpt << " " << compressOpt << "=\n"
+            << "        case " << getArg << "\n"
+            << "            test -z \"$cmd\"; and printf '%s\\n' " << getCmds.join(' ') << "\n"
+            << "        case " << setArg << "\n"
+            << "            if test -z \"$cmd\"\n"
+            << "                printf '%s\\n' " << setCmds.join(' ') << "\n"
+            << "            else if test \"$cmd\" = " << deviceSettingsArg << "; and test -z \"$daemon\"\n"
+            << "                for f in $cache/*; string replace -r '.*/' '' -- $f; end\n"
+            << "            else if test \"$cmd\" = " << deviceSettingsArg << "\n"
+            << "                set -l name (string replace -r '[\\[=].*' '' -- $cur)\n"
+            << "                if test -r \"$cache/$daemon\"\n"
+            << "                    while read -l key vals\n"
+            << "                        if test \"$key\" = settings; set settings (string split ' ' -- $vals)\n"
+            << "                        else if test \"$key\" = \"$name\"; set values (string split ' ' -- $vals)\n"
+            << "                        end\n"
+            << "                    end < \"$cache/$daemon\"\n"
+            << "                end\n"
+            << "                if string match -q '*=*' -- $cur\n"
+            << "                    set -l prefix (string replace -r '=.*' '=' -- $cur)\n"
+            << "                    for val in $values; echo $prefix$val; end\n"
+            << "                else\n"
+            << "                    printf '%s\\n' " << getDeviceSettingsOptions().join(' ') << " $settings\n"
+            << "                end\n"
+            << "            end\n"
+            << "        case " << helpArg << "\n"
+            << "            test -z \"$cmd\"; and printf '%s\\n' " << getHelpOptions().join(' ') << "\n"
+            << "    end\n"
+            << "end\n"
+            << "complete -c " << appName << " -f -a '(" << fnName << ")'\n";
     }
 }
@@ -18,10 +18,30 @@
 #pragma once
 
 #include <QVariant>
+#include <QTextStream>
+#include <span>
 
-#include "CMDArg.h"
+#include "CommandsSchema.h"
+#include "SettingValue.h"
+#include "../Classes/CompletionCache.h"
+#include "../Classes/CommandArena.h"
 
 namespace PWT::CLI {
+    // setting rejected by the cached capabilities of a daemon
+    struct SettingError final {
+        enum struct Kind: int {
+            Unknown, // not a setting of this build, value is the given name
+            Unsupported,
+            InvalidValue,
+            OutOfRange
+        };
+
+        Setting setting;
+        Kind kind;
+        QString value;
+        std::optional<SettingBounds> bounds;
+    };
+
     class CMDParser final {
     private:
         // help text indent level
@@ -32,26 +52,6 @@ namespace PWT::CLI {
         static constexpr int helpIndentLv5 = helpIndentLv4 + 2;
         static constexpr int helpIndentLv6 = helpIndentLv5 + 2;
 
-        // get
-        static constexpr char getArg[] = "get";
-        static constexpr char listDaemonsArg[] = "daemons";
-        static constexpr char dataPathArg[] = "data-path";
-        static constexpr char deviceInfoArg[] = "device-info";
-        static constexpr char profilesArg[] = "profiles";
-        static constexpr char exportProfilesArg[] = "export-profiles";
-        static constexpr char deviceDataArg[] = "device-data";
-
-        // set
-        static constexpr char setArg[] = "set";
-        static constexpr char resetCliSettArg[] = "reset-settings";
-        static constexpr char addDaemonsArg[] = "add-daemons";
-        static constexpr char removeDaemonsArg[] = "remove-daemons";
-        static constexpr char deleteProfileArg[] = "delete-profile";
-        static constexpr char applyProfileArg[] = "apply-profile";
-        static constexpr char importProfilesArg[] = "import-profiles";
-        static constexpr char deviceSettingsArg[] = "device-settings";
-        static constexpr char makeProfileArg[] = "make-profile";
-
         // help
         static constexpr char helpLinuxSettingsArg[] = "linux_settings";
         static constexpr char helpWindowsSettingsArg[] = "windows_settings";
@@ -63,33 +63,44 @@ namespace PWT::CLI {
         static constexpr char helpIntelCPUSettingsArg[] = "intel_cpu_settings";
 #endif
         static constexpr char helpFanControlSettingsArg[] = "fan_control_settings";
+        static constexpr char helpBashCompletionArg[] = "bash_completion";
+        static constexpr char helpZshCompletionArg[] = "zsh_completion";
+        static constexpr char helpFishCompletionArg[] = "fish_completion";
 
-        // set windows schemes options
-        static constexpr char winPsResetDefaultsArg[] = "ps-reset-defaults";
-        static constexpr char winPsReplaceDefaultsArg[] = "ps-replace-defaults";
-        static constexpr char winPsActiveSchemeArg[] = "ps-active-scheme";
-        static constexpr char winPsDeleteSchemesArg[] = "ps-delete-schemes";
-        static constexpr char winPsResetSchemesArg[] = "ps-reset-schemes";
-        static constexpr char winPsCopySchemeSettingsArg[] = "ps-copy-settings";
-        static constexpr char winPsDuplicateSchemeArg[] = "ps-duplicate-scheme";
-
-        // common
-        static constexpr char daemonSettArg[] = "daemon-settings";
+        // output options
+        static constexpr char fieldsOpt[] = "--fields";
+        static constexpr char formatOpt[] = "--format";
+        static constexpr char tableOpt[] = "--table";
+        static constexpr char schemaOpt[] = "--schema";
+        static constexpr char outputOpt[] = "--output";
+        static constexpr char compressOpt[] = "--compress";
+        static constexpr char fromOpt[] = "--from";
 
         // sub args
         static constexpr char daemonArg[] = "\"<daemon|address;port>\"";
 
+        // cpu topology index selectors
+        static constexpr char smtSiblingsSel[] = "smt_siblings";
+
         QHash<CMDArg, QHash<QString, QVariant>> argumentsMap;
+        CompletionCache completionCache;
+        QSet<QString> helpSettingsFilter;
+        QList<QString> unknownSettings;
+        CommandArena arena; // before settingValues, they allocate from it
+        std::array<SettingValue, settingsCount> settingValues;
         char **cmdArgv = nullptr;
         int cmdArgc = 0;
 
         void nextArg(int inc = 1);
         [[nodiscard]] QString helpIndent(int level) const;
         [[nodiscard]] bool isArg(const char *arg, const char *expected) const;
+        [[nodiscard]] bool getOptionValue(const char *option, QString &value);
+        [[nodiscard]] bool parseOutputOptions();
         [[nodiscard]] bool parseMode();
         [[nodiscard]] bool parseGetCommand();
         [[nodiscard]] bool parseSetCommand();
-        [[nodiscard]] bool parseAdvHelpCommand() const;
+        [[nodiscard]] bool parseCommand(const CommandInfo &cmd);
+        [[nodiscard]] bool parseAdvHelpCommand();
         [[nodiscard]] bool parseDaemon();
         [[nodiscard]] bool parseAddDaemons();
         [[nodiscard]] bool parseRemoveDaemons();
@@ -105,7 +116,25 @@ namespace PWT::CLI {
         [[nodiscard]] bool parseWindowsCopySchemeSettings();
         [[nodiscard]] bool parseWindowsDuplicateScheme();
         [[nodiscard]] bool parseDeviceSettings();
+        [[nodiscard]] bool parseSetting(std::string_view arg);
+        [[nodiscard]] QString storeSetting(const SettingInfo &setting, bool indexed, std::string_view idx, const QString &val);
+        [[nodiscard]] bool parseSettingsFile(const QString &path);
+        [[nodiscard]] bool parseIndexSelectors(std::string_view idx, SettingScope scope, std::pmr::vector<SettingValue::IndexSelector> &selectors) const;
+        [[nodiscard]] bool parseDeviceData();
+        [[nodiscard]] bool parseDeviceDataOptions();
         void showHelp() const;
+        void showCommandsHelp(QTextStream &ts, std::span<const CommandInfo> commands) const;
+        void showCommandOptionsHelp(QTextStream &ts, CMDArg arg) const;
+        void showDeviceDataOptionsHelp(QTextStream &ts) const;
+        void showDaemonSettingsListHelp(QTextStream &ts) const;
+        void showDeviceSettingsOptionsHelp(QTextStream &ts) const;
+        void showSettingsGroupHelp(QTextStream &ts, SettingGroup group, const char *title) const;
+        [[nodiscard]] QList<QString> getHelpOptions() const;
+        [[nodiscard]] QList<QString> getDeviceSettingsOptions() const;
+        [[nodiscard]] QString getCompletionCachePath() const;
+        void showBashCompletion() const;
+        void showZshCompletion() const;
+        void showFishCompletion() const;
         void showGetHelp() const;
         void showSetHelp() const;
         void showLinuxSettingsListHelp() const;
@@ -120,8 +149,18 @@ namespace PWT::CLI {
         void showFanControlSettingsListHelp() const;
 
     public:
+        explicit CMDParser(const QString &appDataPath = {});
+
         [[nodiscard]] bool isSet(const CMDArg arg) const { return argumentsMap.contains(arg); }
         [[nodiscard]] bool hasCmdValue(const CMDArg arg, const QString &value) const { return argumentsMap[arg].contains(value); }
+        [[nodiscard]] bool hasSetting(const Setting setting) const { return settingValues[static_cast<int>(setting)].isSet(); }
+        [[nodiscard]] const SettingValue &getSetting(const Setting setting) const { return settingValues[static_cast<int>(setting)]; }
+        [[nodiscard]] bool needsTopology() const;
+        [[nodiscard]] QList<Setting> resolveTopology(const CpuTopology &topology);
+        void expandIndexedSettings(int count);
+        [[nodiscard]] QList<SettingError> validateSettings(const DeviceCapabilities &capabilities) const;
+        [[nodiscard]] QList<SettingError> getUnknownSettings() const;
+        [[nodiscard]] CommandArena::Stats arenaStats() const { return arena.stats(); }
 
         [[nodiscard]] bool parse(int argc, char *argv[]);
         [[nodiscard]] QVariant getCmdValue(CMDArg arg, const QString &value) const;
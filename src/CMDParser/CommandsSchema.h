@@ -0,0 +1,140 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <array>
+#include <string_view>
+
+#include "CMDArg.h"
+
+namespace PWT::CLI {
+    // modes
+    static constexpr char getArg[] = "get";
+    static constexpr char setArg[] = "set";
+    static constexpr char helpArg[] = "help";
+
+    // get
+    static constexpr char listDaemonsArg[] = "daemons";
+    static constexpr char dataPathArg[] = "data-path";
+    static constexpr char deviceInfoArg[] = "device-info";
+    static constexpr char profilesArg[] = "profiles";
+    static constexpr char exportProfilesArg[] = "export-profiles";
+    static constexpr char deviceDataArg[] = "device-data";
+
+    // set
+    static constexpr char resetCliSettArg[] = "reset-settings";
+    static constexpr char addDaemonsArg[] = "add-daemons";
+    static constexpr char removeDaemonsArg[] = "remove-daemons";
+    static constexpr char deleteProfileArg[] = "delete-profile";
+    static constexpr char applyProfileArg[] = "apply-profile";
+    static constexpr char importProfilesArg[] = "import-profiles";
+    static constexpr char deviceSettingsArg[] = "device-settings";
+    static constexpr char makeProfileArg[] = "make-profile";
+    static constexpr char forceApplyArg[] = "--force";
+    static constexpr char dryRunArg[] = "--dry-run";
+    static constexpr char verifyArg[] = "--verify";
+    static constexpr char strictArg[] = "--strict";
+
+    // set windows schemes options
+    static constexpr char winPsResetDefaultsArg[] = "ps-reset-defaults";
+    static constexpr char winPsReplaceDefaultsArg[] = "ps-replace-defaults";
+    static constexpr char winPsActiveSchemeArg[] = "ps-active-scheme";
+    static constexpr char winPsDeleteSchemesArg[] = "ps-delete-schemes";
+    static constexpr char winPsResetSchemesArg[] = "ps-reset-schemes";
+    static constexpr char winPsCopySchemeSettingsArg[] = "ps-copy-settings";
+    static constexpr char winPsDuplicateSchemeArg[] = "ps-duplicate-scheme";
+
+    // common
+    static constexpr char daemonSettArg[] = "daemon-settings";
+
+    struct CommandInfo final {
+        std::string_view name;
+        CMDArg arg;
+        bool daemon; // first argument is the target daemon
+        std::string_view usage;
+        std::string_view help; // one line per '\n'
+    };
+
+    // listed in help order
+    static constexpr std::array getCommands {
+        CommandInfo {dataPathArg, CMDArg::GET_DATA_PATH, false, "", "Print CLI data path."},
+        CommandInfo {listDaemonsArg, CMDArg::GET_DAEMON_LIST, false, "", "List saved daemons."},
+        CommandInfo {daemonSettArg, CMDArg::GET_DAEMON_SETTINGS, true, "", "Request and print daemon settings."},
+        CommandInfo {deviceInfoArg, CMDArg::GET_DEVICE_INFO, true, "", "Request and print device info."},
+        CommandInfo {profilesArg, CMDArg::GET_PROFILE_LIST, true, "", "Request and print available profiles."},
+        CommandInfo {exportProfilesArg, CMDArg::GET_EXPORT_PROFILES, true, "<output path> <profile|all>", "Download a profile, or \"all\", to <output path>."},
+        CommandInfo {deviceDataArg, CMDArg::GET_DEVICE_DATA, true, "<options>", "Request and print device data."}
+    };
+
+    static constexpr std::array setCommands {
+        CommandInfo {resetCliSettArg, CMDArg::SET_RESET_CLI_SETTINGS, false, "", "Reset CLI settings."},
+        CommandInfo {addDaemonsArg, CMDArg::SET_ADD_DAEMONS, false, "<name> <address> <port>", "List of daemons (name, address and port) to add to CLI."},
+        CommandInfo {removeDaemonsArg, CMDArg::SET_REMOVE_DAEMONS, false, "<name|address>", "List of space separated daemons to remove from CLI."},
+        CommandInfo {daemonSettArg, CMDArg::SET_DAEMON_SETTINGS, true, "<setting=value>", "List of daemon settings, with their value, to set."},
+        CommandInfo {deleteProfileArg, CMDArg::SET_DELETE_PROFILE, true, "<profile>", "Delete a profile from disk."},
+        CommandInfo {applyProfileArg, CMDArg::SET_APPLY_PROFILE, true, "<profile> [--verify]", "Apply settings from profile.\nWith --verify, device data is read back after apply and added to the result."},
+        CommandInfo {importProfilesArg, CMDArg::SET_IMPORT_PROFILES, true, "<profile>", "List of space separated paths to profiles to import."},
+        CommandInfo {deviceSettingsArg, CMDArg::SET_DEVICE_SETTINGS, true, "<setting=value>", "List of device settings, with their value, to set."}
+    };
+
+    // device-settings options
+    static constexpr std::array deviceSettingsOptions {
+        CommandInfo {makeProfileArg, CMDArg::SET_MAKE_PROFILE, false, "<profile name>", "Create a profile from current device settings."},
+        CommandInfo {forceApplyArg, CMDArg::SET_FORCE_APPLY, false, "",
+            "Send all settings, even if they match the current device data.\n"
+            "By default only the settings that differ are applied, and nothing is sent if none does."},
+        CommandInfo {dryRunArg, CMDArg::SET_DRY_RUN, false, "",
+            "Print the changes, and the values clamped to their range, without applying them.\n"
+            "Changes are in device-data format, each one as {\"from\": <current>, \"to\": <new>}."},
+        CommandInfo {verifyArg, CMDArg::SET_VERIFY, false, "",
+            "Read device data back after apply and compare it with the changes sent.\n"
+            "Changes not matching are added to the result, as {\"requested\": <value>, \"value\": <current>}."},
+        CommandInfo {strictArg, CMDArg::SET_STRICT, false, "",
+            "Refuse partial applies, nothing is sent if any setting is unknown, unsupported, invalid or out of range.\n"
+            "Settings are checked against the cached daemon capabilities before connecting, when available,\n"
+            "and always against the device data read after connecting."}
+    };
+
+    static constexpr std::array windowsSchemesOptions {
+        CommandInfo {winPsResetDefaultsArg, CMDArg::SET_WIN_SCHEMES_RESET_DEFAULTS, false, "", "Reset power schemes to default before applying settings."},
+        CommandInfo {winPsReplaceDefaultsArg, CMDArg::SET_WIN_SCHEMES_REPLACE_DEFAULTS, false, "", "Replace default power schemes with current schemes after apply."},
+        CommandInfo {winPsActiveSchemeArg, CMDArg::SET_WIN_ACTIVE_SCHEME, false, "<scheme GUID>", "Set the active power scheme."},
+        CommandInfo {winPsDeleteSchemesArg, CMDArg::SET_WIN_DELETE_SCHEMES, false, "<scheme GUID>", "Comma separated list of power schemes to delete."},
+        CommandInfo {winPsResetSchemesArg, CMDArg::SET_WIN_RESET_SCHEMES, false, "<scheme GUID>", "Comma separated list of power schemes to reset to defaults from default user schemes stored in HKEY_USERS\\.Default."},
+        CommandInfo {winPsCopySchemeSettingsArg, CMDArg::SET_WIN_SCHEME_COPY_SETTINGS, false, "<from scheme GUID> <from mode> <to scheme GUID> <to mode>",
+            "Copy all settings from one scheme to another.\n"
+            "<from mode> valid values: ac, dc.\n"
+            "<to mode> valid values: ac, dc, all.\n"
+            "Copy command is run before power_scheme and after ps-duplicate-scheme."},
+        CommandInfo {winPsDuplicateSchemeArg, CMDArg::SET_WIN_DUPLICATE_SCHEME, false, "<base scheme GUID> <scheme name> <temp scheme handle>",
+            "Create a new power scheme based on <base scheme GUID>.\n"
+            "<temp scheme handle> is a string you can use, in place of its GUID, to set its settings.\n"
+            "<temp scheme handle> allowed characters: [a-z0-9_-].\n"
+            "Duplicate command is run before power_scheme."}
+    };
+
+    template<size_t N>
+    [[nodiscard]] constexpr const CommandInfo *findCommand(const std::array<CommandInfo, N> &commands, const std::string_view name) {
+        for (const CommandInfo &cmd: commands) {
+            if (cmd.name == name)
+                return &cmd;
+        }
+
+        return nullptr;
+    }
+}
@@ -0,0 +1,215 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+
+#include "SettingValue.h"
+
+namespace PWT::CLI {
+    SettingValue::SettingValue(std::pmr::memory_resource *resource): assignments(resource), ranges(resource) {}
+
+    std::optional<SettingValue::Value> SettingValue::fromString(const SettingType type, const QString &str) {
+        switch (type) {
+            case SettingType::Int: {
+                bool ok;
+                const int val = str.toInt(&ok);
+
+                if (!ok)
+                    return std::nullopt;
+
+                return val;
+            }
+            case SettingType::Bool: {
+                if (str == "1" || str.compare("true", Qt::CaseInsensitive) == 0)
+                    return true;
+                else if (str == "0" || str.compare("false", Qt::CaseInsensitive) == 0)
+                    return false;
+
+                return std::nullopt;
+            }
+            case SettingType::String:
+                return str;
+            default:
+                break;
+        }
+
+        return std::nullopt;
+    }
+
+    void SettingValue::set(std::pmr::vector<IndexSelector> &&selectors, const Value &val) {
+        assignments.push_back({std::move(selectors), val});
+
+        const Assignment &assignment = assignments.back();
+
+        for (const IndexSelector &selector: assignment.selectors)
+            hasGroups |= selector.group != TopologyGroup::None;
+
+        // wait for the topology to keep arguments order
+        if (hasGroups)
+            return;
+
+        for (const IndexSelector &selector: assignment.selectors)
+            setRange(selector.first, selector.last, val);
+    }
+
+    bool SettingValue::resolve(const CpuTopology &topology) {
+        bool ok = true;
+
+        ranges.clear();
+
+        for (const Assignment &assignment: assignments) {
+            for (const IndexSelector &selector: assignment.selectors) {
+                if (selector.group == TopologyGroup::None) {
+                    setRange(selector.first, selector.last, assignment.value);
+                    continue;
+                }
+
+                if (!topology.hasGroup(selector.group)) {
+                    ok = false;
+                    continue;
+                }
+
+                const QList<int> indexes = topology.getThreads(selector.group);
+
+                // indexes are sorted, set consecutive ones as a single range
+                for (int i=0,l=indexes.size(); i<l;) {
+                    int last = i;
+
+                    while ((last + 1) < l && indexes[last + 1] == (indexes[last] + 1))
+                        ++last;
+
+                    setRange(indexes[i], indexes[last], assignment.value);
+                    i = last + 1;
+                }
+            }
+        }
+
+        hasGroups = false;
+        return ok;
+    }
+
+    QList<SettingValue::Value> SettingValue::values() const {
+        QList<Value> list;
+
+        if (value)
+            list.append(*value);
+
+        for (const Assignment &assignment: assignments)
+            list.append(assignment.value);
+
+        for (const Value &val: indexed)
+            list.append(val);
+
+        return list;
+    }
+
+    void SettingValue::expand(const int count) {
+        dense.clear();
+
+        if (value || ranges.empty() || count <= 0)
+            return;
+
+        dense.fill(-1, count);
+
+        for (int r=0,l=static_cast<int>(ranges.size()); r<l; ++r) {
+            if (ranges[r].first >= count)
+                break;
+
+            for (int i=ranges[r].first,last=std::min(ranges[r].last, count - 1); i<=last; ++i)
+                dense[i] = r;
+        }
+    }
+
+    // later ranges override overlapping parts of earlier ones, like arguments order.
+    // merged in place, the arena only sees the geometric growth of the list
+    void SettingValue::setRange(const int first, const int last, const Value &val) {
+        const auto lo = std::lower_bound(ranges.begin(), ranges.end(), first, [](const IndexRange &range, const int i) {
+            return range.last < i;
+        });
+        const auto hi = std::upper_bound(lo, ranges.end(), last, [](const int i, const IndexRange &range) {
+            return i < range.first;
+        });
+        std::optional<IndexRange> left;
+        std::optional<IndexRange> right;
+
+        if (lo != hi) {
+            if (lo->first < first)
+                left = IndexRange {lo->first, first - 1, lo->value};
+
+            if (std::prev(hi)->last > last)
+                right = IndexRange {last + 1, std::prev(hi)->last, std::prev(hi)->value};
+        }
+
+        auto it = ranges.erase(lo, hi);
+
+        if (right)
+            it = ranges.insert(it, std::move(*right));
+
+        it = ranges.insert(it, IndexRange {first, last, val});
+
+        if (left)
+            ranges.insert(it, std::move(*left));
+
+        dense.clear();
+    }
+
+    const SettingValue::Value *SettingValue::findIndex(const int idx) const {
+        const auto it = std::upper_bound(ranges.cbegin(), ranges.cend(), idx, [](const int i, const IndexRange &range) {
+            return i < range.first;
+        });
+
+        if (it == ranges.cbegin() || idx > std::prev(it)->last)
+            return nullptr;
+
+        return &std::prev(it)->value;
+    }
+
+    const SettingValue::Value *SettingValue::find(const int idx) const {
+        if (value)
+            return &*value;
+
+        if (idx >= 0 && idx < dense.size())
+            return dense[idx] == -1 ? nullptr : &ranges[dense[idx]].value;
+
+        if (!ranges.empty())
+            return findIndex(idx);
+
+        // unset settings are looked up for every cpu, skip the key string
+        if (indexed.isEmpty())
+            return nullptr;
+
+        const auto it = indexed.constFind(QString::number(idx));
+
+        return it == indexed.constEnd() ? nullptr : &*it;
+    }
+
+    const SettingValue::Value *SettingValue::find(const QString &idx) const {
+        if (value)
+            return &*value;
+
+        if (!ranges.empty()) {
+            bool ok;
+            const int i = idx.toInt(&ok);
+
+            return ok ? find(i) : nullptr;
+        }
+
+        const auto it = indexed.constFind(idx);
+
+        return it == indexed.constEnd() ? nullptr : &*it;
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <optional>
+#include <limits>
+#include <memory_resource>
+#include <variant>
+#include <vector>
+
+#include "SettingsSchema.h"
+#include "../Classes/CpuTopology.h"
+
+namespace PWT::CLI {
+    // device setting value, converted to its schema type at parse time
+    class SettingValue final {
+    public:
+        using Value = std::variant<int, bool, QString>;
+
+        struct IndexSelector final {
+            TopologyGroup group = TopologyGroup::None;
+            int first = 0;
+            int last = 0;
+        };
+
+    private:
+        struct IndexRange final {
+            int first;
+            int last;
+            Value value;
+        };
+
+        struct Assignment final {
+            std::pmr::vector<IndexSelector> selectors;
+            Value value;
+        };
+
+        // assignments and ranges live in the command arena
+        std::optional<Value> value; // global setting
+        std::pmr::vector<Assignment> assignments; // cpu and gpu indexes, in arguments order
+        std::pmr::vector<IndexRange> ranges; // resolved assignments, sorted and not overlapping
+        QHash<QString, Value> indexed;
+        QList<int> dense; // ranges position per index, see expand
+        bool hasGroups = false;
+
+        void setRange(int first, int last, const Value &val);
+        [[nodiscard]] const Value *findIndex(int idx) const;
+        [[nodiscard]] const Value *find(int idx) const;
+        [[nodiscard]] const Value *find(const QString &idx) const;
+
+        template<typename T, typename I>
+        [[nodiscard]] std::optional<T> getAt(const I &idx) const {
+            const Value *val = find(idx);
+
+            if (val == nullptr)
+                return std::nullopt;
+
+            return std::get<T>(*val);
+        }
+
+    public:
+        static constexpr int maxIndex = std::numeric_limits<int>::max();
+
+        explicit SettingValue(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+        SettingValue(const SettingValue &) = delete;
+        SettingValue &operator=(const SettingValue &) = delete;
+
+        [[nodiscard]] static std::optional<Value> fromString(SettingType type, const QString &str);
+
+        [[nodiscard]] bool isSet() const { return value.has_value() || !assignments.empty() || !indexed.isEmpty(); }
+        void set(const Value &val) { value = val; }
+        void set(const QString &idx, const Value &val) { indexed.insert(idx, val); }
+        void set(std::pmr::vector<IndexSelector> &&selectors, const Value &val);
+
+        // topology groups are resolved once the device data is known
+        [[nodiscard]] bool needsTopology() const { return hasGroups; }
+        [[nodiscard]] bool resolve(const CpuTopology &topology);
+
+        // index lookups below count no longer search the ranges
+        void expand(int count);
+
+        [[nodiscard]] int toInt() const { return std::get<int>(*value); }
+        [[nodiscard]] bool toBool() const { return std::get<bool>(*value); }
+        [[nodiscard]] QString toString() const { return std::get<QString>(*value); }
+
+        [[nodiscard]] std::optional<int> intAt(const int idx) const { return getAt<int>(idx); }
+        [[nodiscard]] std::optional<bool> boolAt(const int idx) const { return getAt<bool>(idx); }
+        [[nodiscard]] std::optional<QString> stringAt(const int idx) const { return getAt<QString>(idx); }
+        [[nodiscard]] std::optional<int> intAt(const QString &idx) const { return getAt<int>(idx); }
+        [[nodiscard]] std::optional<bool> boolAt(const QString &idx) const { return getAt<bool>(idx); }
+        [[nodiscard]] std::optional<QString> stringAt(const QString &idx) const { return getAt<QString>(idx); }
+
+        // per device, fan or scheme values
+        [[nodiscard]] const QHash<QString, Value> &entries() const { return indexed; }
+
+        // every given value, whatever its index
+        [[nodiscard]] QList<Value> values() const;
+    };
+}
@@ -0,0 +1,643 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QString>
+#include <array>
+#include <string_view>
+
+#include "pwtShared/Include/Features.h"
+
+namespace PWT::CLI {
+    enum struct Setting: int {
+        SmtState,
+        CpuIdleGovernor,
+        BlockDevQueSched,
+        MiscPmDevs,
+        CpuMinFreq,
+        CpuMaxFreq,
+        CpuScalingGovernor,
+        CpuStatus,
+#ifdef WITH_AMD
+        PstateStatus,
+        PstateEpp,
+#endif
+        GpuRpsMinFreq,
+        GpuRpsMaxFreq,
+        GpuRpsMaxBoost,
+        PowerDpmState,
+        PowerDpmForcePerfLvl,
+        PowerDpmForcePerfMinSclk,
+        PowerDpmForcePerfMaxSclk,
+        PowerDpmForcePerfReset,
+        PowerScheme,
+        FanMode,
+        FanTripPoint,
+#ifdef WITH_INTEL
+        PkgLimitPl1,
+        PkgLimitPl2,
+        PkgLimitPl1Time,
+        PkgLimitPl2Time,
+        PkgLimitPl1Clamp,
+        PkgLimitPl2Clamp,
+        PkgLimitPl1Enable,
+        PkgLimitPl2Enable,
+        PkgLimitLock,
+        VrCurrentCfgPl4,
+        VrCurrentCfgLock,
+        Pp1CurrentLimit,
+        Pp1CurrentLock,
+        TurboPwrCurrentTdp,
+        TurboPwrCurrentTdpEnable,
+        TurboPwrCurrentTdc,
+        TurboPwrCurrentTdcEnable,
+        TurboRatioLimit1c,
+        TurboRatioLimit2c,
+        TurboRatioLimit3c,
+        TurboRatioLimit4c,
+        TurboRatioLimit5c,
+        TurboRatioLimit6c,
+        TurboRatioLimit7c,
+        TurboRatioLimit8c,
+        EnhancedSpeedstepEnable,
+        TurboModeDisable,
+        BdProchotEnable,
+        C1eEnable,
+        SapmImcC2Policy,
+        FastBrkSnpEn,
+        PowerPerformancePlatformOverride,
+        EnergyEfficiencyOptDisable,
+        RaceToHaltDisable,
+        ProchotOutputDisable,
+        ProchotCfgResponseEnable,
+        VrThermAlertDisableLock,
+        VrThermAlertDisable,
+        RingEEDisable,
+        SaOptDisable,
+        OokDisable,
+        HwpAutonomousDisable,
+        CstatePrewakeDisable,
+        EistDisable,
+        Pp0Priority,
+        Pp1Priority,
+        EnergyPerfBias,
+        UvControlCpu,
+        UvControlGpu,
+        UvControlCache,
+        UvControlUnslice,
+        UvControlSa,
+        HwpEnable,
+        HwpPkgCtlPolarityEnable,
+        HwpRequestPkgMinPerf,
+        HwpRequestPkgMaxPerf,
+        HwpRequestPkgDesiredPerf,
+        HwpRequestPkgEpp,
+        HwpRequestPkgAcw,
+        HwpRequestMinPerf,
+        HwpRequestMaxPerf,
+        HwpRequestDesiredPerf,
+        HwpRequestEpp,
+        HwpRequestAcw,
+        HwpRequestPkgControl,
+        HwpRequestMinValid,
+        HwpRequestMaxValid,
+        HwpRequestDesiredValid,
+        HwpRequestAcwValid,
+        HwpRequestEppValid,
+        PkgCstCfgControlCstateLim,
+        PkgCstCfgControlMaxCoreCstate,
+        PkgCstCfgControlIOMWaitRedirectEnable,
+        PkgCstCfgControlCfgLock,
+        PkgCstCfgControlC3StateAutodemotionEnable,
+        PkgCstCfgControlC1StateAutodemotionEnable,
+        PkgCstCfgControlC3UndemotionEnable,
+        PkgCstCfgControlC1UndemotionEnable,
+        PkgCstCfgControlPkgcAutodemotionEnable,
+        PkgCstCfgControlPkgcUndemotionEnable,
+        PkgCstCfgControlTimedMwaitEnable,
+        PkgRaplPl1,
+        PkgRaplPl2,
+        PkgRaplPl1Enable,
+        PkgRaplPl2Enable,
+        PkgRaplPl1Time,
+        PkgRaplPl1Clamp,
+        PkgRaplLock,
+#endif
+#ifdef WITH_AMD
+        StapmLimit,
+        FastLimit,
+        SlowLimit,
+        TctlTemp,
+        ApuSlow,
+        ApuSkinTemp,
+        DgpuSkinTemp,
+        CurveOptimizer,
+        CurveOptimizerPer,
+        VrmCurrent,
+        VrmSocCurrent,
+        VrmMaxCurrent,
+        VrmSocMaxCurrent,
+        StaticGfxClk,
+        MinGfxClk,
+        MaxGfxClk,
+        AmdPowerProfile,
+        CorePerfBoost,
+        PstateCmd,
+        CppcEnable,
+        CppcRequestMaxPerf,
+        CppcRequestMinPerf,
+        CppcRequestDesiredPerf,
+        CppcRequestEpp,
+#endif
+        Count
+    };
+
+    enum struct SettingGroup: int {
+        LinuxSysfs,
+        LinuxIntelGPU,
+        LinuxAMDGPU,
+        LinuxAMD,
+        Windows,
+        FanControl,
+        IntelCPU,
+        AMDCPU
+    };
+
+    // what setting[idx] refers to, global settings take no index
+    enum struct SettingScope: int {
+        Global,
+        Thread,
+        Core,
+        GPU,
+        Device,
+        Fan,
+        Scheme
+    };
+
+    enum struct SettingType: int {
+        Int,
+        Bool,
+        String
+    };
+
+    // where to find possible values, printed at the end of the setting help
+    enum struct SettingHint: int {
+        None,
+        DataRequest,
+        InfoRequest
+    };
+
+    struct SettingInfo final {
+        Setting id;
+        std::string_view name;
+        SettingGroup group;
+        SettingScope scope;
+        SettingType type;
+        SettingHint hint;
+        std::string_view help; // one line per '\n', '\t' marks a list item
+    };
+
+    // accepted values of an int setting on a device
+    struct SettingBounds final {
+        int min = 0;
+        int max = 0;
+    };
+
+    // daemon features a setting needs, the group feature is checked first
+    struct SettingFeatures final {
+        PWTS::Feature group;
+        PWTS::Feature feature;
+    };
+
+    static constexpr int settingsCount = static_cast<int>(Setting::Count);
+
+    // ordered as Setting
+    static constexpr std::array<SettingInfo, settingsCount> settingsSchema {{
+        {Setting::SmtState, "smt_state", SettingGroup::LinuxSysfs, SettingScope::Global, SettingType::String, SettingHint::None,
+            "Simultaneous Multi-Threading / Hyper-Threading. [on, off, forceoff]"},
+        {Setting::CpuIdleGovernor, "cpu_idle_governor", SettingGroup::LinuxSysfs, SettingScope::Global, SettingType::String, SettingHint::DataRequest,
+            "CPU Idle Governor."},
+        {Setting::BlockDevQueSched, "block_device_que_sched", SettingGroup::LinuxSysfs, SettingScope::Device, SettingType::String, SettingHint::DataRequest,
+            "Block device queue scheduler.\n"
+            "Usage: block_device_que_sched[device]=scheduler.\n"
+            "Example: \"block_device_que_sched[sda]\"=mq-deadline."},
+        {Setting::MiscPmDevs, "misc_device_pm", SettingGroup::LinuxSysfs, SettingScope::Device, SettingType::String, SettingHint::DataRequest,
+            "Devices power management mode. [auto, on]\n"
+            "Usage: misc_device_pm[control path]=mode.\n"
+            "Example: \"misc_device_pm[/sys/bus/usb/devices/2-1/power/control]\"=auto."},
+        {Setting::CpuMinFreq, "cpu_min_freq", SettingGroup::LinuxSysfs, SettingScope::Thread, SettingType::Int, SettingHint::DataRequest,
+            "CPU minimum frequency."},
+        {Setting::CpuMaxFreq, "cpu_max_freq", SettingGroup::LinuxSysfs, SettingScope::Thread, SettingType::Int, SettingHint::DataRequest,
+            "CPU maximum frequency."},
+        {Setting::CpuScalingGovernor, "cpu_scaling_governor", SettingGroup::LinuxSysfs, SettingScope::Thread, SettingType::String, SettingHint::DataRequest,
+            "CPU scaling governor."},
+        {Setting::CpuStatus, "cpu_status", SettingGroup::LinuxSysfs, SettingScope::Thread, SettingType::Bool, SettingHint::None,
+            "CPU online status. [0,1]"},
+#ifdef WITH_AMD
+        {Setting::PstateStatus, "pstate_status", SettingGroup::LinuxAMD, SettingScope::Global, SettingType::String, SettingHint::None,
+            "AMD PState Scaling Driver status. [disable, active, passive, guided]"},
+        {Setting::PstateEpp, "pstate_epp", SettingGroup::LinuxAMD, SettingScope::Thread, SettingType::String, SettingHint::DataRequest,
+            "Requires pstate_status=active\n"
+            "AMD PState Scaling Driver energy performance preference."},
+#endif
+        {Setting::GpuRpsMinFreq, "gpu_rps_min_freq", SettingGroup::LinuxIntelGPU, SettingScope::GPU, SettingType::Int, SettingHint::DataRequest,
+            "GPU minimum frequency."},
+        {Setting::GpuRpsMaxFreq, "gpu_rps_max_freq", SettingGroup::LinuxIntelGPU, SettingScope::GPU, SettingType::Int, SettingHint::DataRequest,
+            "GPU maximum frequency."},
+        {Setting::GpuRpsMaxBoost, "gpu_rps_max_boost", SettingGroup::LinuxIntelGPU, SettingScope::GPU, SettingType::Int, SettingHint::DataRequest,
+            "GPU maximum boost frequency."},
+        {Setting::PowerDpmState, "power_dpm_state", SettingGroup::LinuxAMDGPU, SettingScope::GPU, SettingType::String, SettingHint::None,
+            "Legacy power DPM state. [battery, balanced, performance]"},
+        {Setting::PowerDpmForcePerfLvl, "power_dpm_force_perf_level", SettingGroup::LinuxAMDGPU, SettingScope::GPU, SettingType::String, SettingHint::None,
+            "Power DPM force performance level.\n"
+            "[auto, low, high, manual, profile_standard, profile_min_sclk, profile_min_mclk, profile_peak]"},
+        {Setting::PowerDpmForcePerfMinSclk, "power_dpm_force_perf_min_sclk", SettingGroup::LinuxAMDGPU, SettingScope::GPU, SettingType::Int, SettingHint::DataRequest,
+            "GPU minimum sclk. Requires power_dpm_force_perf_level=manual."},
+        {Setting::PowerDpmForcePerfMaxSclk, "power_dpm_force_perf_max_sclk", SettingGroup::LinuxAMDGPU, SettingScope::GPU, SettingType::Int, SettingHint::DataRequest,
+            "GPU maximum sclk. Requires power_dpm_force_perf_level=manual."},
+        {Setting::PowerDpmForcePerfReset, "power_dpm_force_perf_reset", SettingGroup::LinuxAMDGPU, SettingScope::GPU, SettingType::Bool, SettingHint::None,
+            "Perform DPM performance level settings reset. [0,1]"},
+        {Setting::PowerScheme, "power_scheme", SettingGroup::Windows, SettingScope::Scheme, SettingType::Int, SettingHint::DataRequest,
+            "Windows power scheme setting."},
+        {Setting::FanMode, "fan_mode", SettingGroup::FanControl, SettingScope::Fan, SettingType::Int, SettingHint::None,
+            "Fan mode. [0=auto, 1=manual]"},
+        {Setting::FanTripPoint, "fan_trip_point", SettingGroup::FanControl, SettingScope::Fan, SettingType::Int, SettingHint::None,
+            "Fan temperature trip point. Requires fan_mode[id]=1.\n"
+            "Define more than one trip point to create a curve.\n"
+            "To set a fixed fan speed, provide only one trip point with no temperature.\n"
+            "\n"
+            "Usage: \"fan_trip_point[id:temperature_celsius]=speed_percent\".\n"
+            "Usage (fixed speed): \"fan_trip_point[id]=speed_percent\".\n"
+            "Example: \"fan_trip_point[3hd907:40]=25\"."},
+#ifdef WITH_INTEL
+        {Setting::PkgLimitPl1, "pkg_limit_pl1", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "PKG power limit PL1 (watts)."},
+        {Setting::PkgLimitPl2, "pkg_limit_pl2", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "PKG power limit PL2 (watts)."},
+        {Setting::PkgLimitPl1Time, "pkg_limit_pl1_time", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "PKG power limit PL1 time window. [0, 56000]"},
+        {Setting::PkgLimitPl2Time, "pkg_limit_pl2_time", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "PKG power limit PL2 time window. [0, 56000]"},
+        {Setting::PkgLimitPl1Clamp, "pkg_limit_pl1_clamp", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable value clamp for PKG power limit PL1. [0,1]"},
+        {Setting::PkgLimitPl2Clamp, "pkg_limit_pl2_clamp", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable value clamp for PKG power limit PL2. [0,1]"},
+        {Setting::PkgLimitPl1Enable, "pkg_limit_pl1_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable PKG power limit PL1. [0,1]"},
+        {Setting::PkgLimitPl2Enable, "pkg_limit_pl2_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable PKG power limit PL2. [0,1]"},
+        {Setting::PkgLimitLock, "pkg_limit_lock", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Lock PKG power limit register until device reboot. [0,1]"},
+        {Setting::VrCurrentCfgPl4, "vr_current_cfg_pl4", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "VR current config limit PL4 (watts)."},
+        {Setting::VrCurrentCfgLock, "vr_current_cfg_lock", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Lock VR current config register until device reboot. [0,1]"},
+        {Setting::Pp1CurrentLimit, "pp1_current_limit", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Graphics current config (PP1) limit (watts)."},
+        {Setting::Pp1CurrentLock, "pp1_current_lock", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Lock graphics current config (PP1) register until device reboot. [0,1]"},
+        {Setting::TurboPwrCurrentTdp, "turbo_pwr_current_tdp", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Turbo power current TDP limit (watts)."},
+        {Setting::TurboPwrCurrentTdpEnable, "turbo_pwr_current_tdp_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable turbo power current TDP limit. [0,1]"},
+        {Setting::TurboPwrCurrentTdc, "turbo_pwr_current_tdc", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Turbo power current TDC limit (watts)."},
+        {Setting::TurboPwrCurrentTdcEnable, "turbo_pwr_current_tdc_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable turbo power current TDC limit. [0,1]"},
+        {Setting::TurboRatioLimit1c, "turbo_ratio_limit_1c", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Turbo ratio limit for 1 core. [1, 255]"},
+        {Setting::TurboRatioLimit2c, "turbo_ratio_limit_2c", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Turbo ratio limit for 2 cores. [1, 255]"},
+        {Setting::TurboRatioLimit3c, "turbo_ratio_limit_3c", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Turbo ratio limit for 3 cores. [1, 255]"},
+        {Setting::TurboRatioLimit4c, "turbo_ratio_limit_4c", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Turbo ratio limit for 4 cores. [1, 255]"},
+        {Setting::TurboRatioLimit5c, "turbo_ratio_limit_5c", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Turbo ratio limit for 5 cores. [1, 255]"},
+        {Setting::TurboRatioLimit6c, "turbo_ratio_limit_6c", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Turbo ratio limit for 6 cores. [1, 255]"},
+        {Setting::TurboRatioLimit7c, "turbo_ratio_limit_7c", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Turbo ratio limit for 7 cores. [1, 255]"},
+        {Setting::TurboRatioLimit8c, "turbo_ratio_limit_8c", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Turbo ratio limit for 8 cores. [1, 255]"},
+        {Setting::EnhancedSpeedstepEnable, "enhanced_speedstep_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable CPU enhanced speedstep technology. [0,1]"},
+        {Setting::TurboModeDisable, "turbo_mode_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable CPU turbo boost. [0,1]"},
+        {Setting::BdProchotEnable, "bd_prochot_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable Bi-Directional PROCHOT. [0,1]"},
+        {Setting::C1eEnable, "c1e_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable C1 Enhanced (C1E). [0,1]"},
+        {Setting::SapmImcC2Policy, "self_refresh_pkg_c2_state_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Allow self-refresh in package C2 state. [0,1]"},
+        {Setting::FastBrkSnpEn, "fast_vid_swing_rate_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Use fast VID swing rate. [0,1]"},
+        {Setting::PowerPerformancePlatformOverride, "power_performance_platform_override", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Power performance platform override. [0,1]"},
+        {Setting::EnergyEfficiencyOptDisable, "energy_efficiency_opt_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable energy efficiency optimization. [0,1]"},
+        {Setting::RaceToHaltDisable, "race_to_halt_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable race to halt optimization. [0,1]"},
+        {Setting::ProchotOutputDisable, "prochot_output_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable PROCHOT output. [0,1]"},
+        {Setting::ProchotCfgResponseEnable, "prochot_cfg_response_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable PROCHOT configurable response. [0,1]"},
+        {Setting::VrThermAlertDisableLock, "prochot_bits_lock_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Lock PROCHOT bits until device reboot. [0,1]"},
+        {Setting::VrThermAlertDisable, "vr_thermal_alert_signaling_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable VR_THERMAL_ALERT signaling. [0,1]"},
+        {Setting::RingEEDisable, "ring_ee_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable ring EE. [0,1]"},
+        {Setting::SaOptDisable, "sa_opt_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable SA optimization. [0,1]"},
+        {Setting::OokDisable, "ook_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable OOK. [0,1]"},
+        {Setting::HwpAutonomousDisable, "hwp_autonomous_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable HWP autonomous mode. [0,1]"},
+        {Setting::CstatePrewakeDisable, "cstate_prewake_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable C-state pre-wake. [0,1]"},
+        {Setting::EistDisable, "eist_disable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Disable EIST (Enhanced SpeedStep) hardware coordination. [0,1]"},
+        {Setting::Pp0Priority, "pp0_priority", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "CPU power balance. [0, 31]"},
+        {Setting::Pp1Priority, "pp1_priority", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "GPU power balance. [0, 31]"},
+        {Setting::EnergyPerfBias, "energy_perf_bias", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Performance Energy Bias Hint. [0, 15]"},
+        {Setting::UvControlCpu, "uv_control_cpu", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "CPU undervolt offset."},
+        {Setting::UvControlGpu, "uv_control_gpu", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "GPU undervolt offset."},
+        {Setting::UvControlCache, "uv_control_cache", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Cache undervolt offset."},
+        {Setting::UvControlUnslice, "uv_control_unslice", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Unslice undervolt offset."},
+        {Setting::UvControlSa, "uv_control_sa", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "SysAgent undervolt offset."},
+        {Setting::HwpEnable, "hwp_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable HWP. [1,1]"},
+        {Setting::HwpPkgCtlPolarityEnable, "hwp_pkg_ctl_polarity_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable HWP pkg ctl polarity. [0,1]"},
+        {Setting::HwpRequestPkgMinPerf, "hwp_request_pkg_min_perf", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::DataRequest,
+            "HWP request pkg minimum performance."},
+        {Setting::HwpRequestPkgMaxPerf, "hwp_request_pkg_max_perf", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::DataRequest,
+            "HWP request pkg maximum performance."},
+        {Setting::HwpRequestPkgDesiredPerf, "hwp_request_pkg_desired_perf", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::DataRequest,
+            "HWP request pkg desired performance."},
+        {Setting::HwpRequestPkgEpp, "hwp_request_pkg_epp", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "HWP request pkg energy performance preference. [0, 255]"},
+        {Setting::HwpRequestPkgAcw, "hwp_request_pkg_acw", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "HWP request pkg activity window. [0, 127000]"},
+        {Setting::HwpRequestMinPerf, "hwp_request_min_perf", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Int, SettingHint::DataRequest,
+            "HWP request minimum performance."},
+        {Setting::HwpRequestMaxPerf, "hwp_request_max_perf", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Int, SettingHint::DataRequest,
+            "HWP request maximum performance."},
+        {Setting::HwpRequestDesiredPerf, "hwp_request_desired_perf", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Int, SettingHint::DataRequest,
+            "HWP request desired performance."},
+        {Setting::HwpRequestEpp, "hwp_request_epp", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Int, SettingHint::None,
+            "HWP request energy performance preference. [0, 255]"},
+        {Setting::HwpRequestAcw, "hwp_request_acw", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Int, SettingHint::None,
+            "HWP request activity window. [0, 127000]"},
+        {Setting::HwpRequestPkgControl, "hwp_request_pkg_control", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Bool, SettingHint::None,
+            "HWP request package control flag. [0,1]\n"
+            "Enabled on all cpus when per-cpu requests are sent as a package request, it stays enabled after the command.\n"
+            "Per-cpu hwp_request_* values without this setting disable it on the cpus they are set for."},
+        {Setting::HwpRequestMinValid, "hwp_request_min_valid", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Bool, SettingHint::None,
+            "HWP request minimum performance validity. [0,1]"},
+        {Setting::HwpRequestMaxValid, "hwp_request_max_valid", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Bool, SettingHint::None,
+            "HWP request maximum performance validity. [0,1]"},
+        {Setting::HwpRequestDesiredValid, "hwp_request_desired_valid", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Bool, SettingHint::None,
+            "HWP request desired performance validity. [0,1]"},
+        {Setting::HwpRequestAcwValid, "hwp_request_acw_valid", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Bool, SettingHint::None,
+            "HWP request activity window validity. [0,1]"},
+        {Setting::HwpRequestEppValid, "hwp_request_epp_valid", SettingGroup::IntelCPU, SettingScope::Thread, SettingType::Bool, SettingHint::None,
+            "HWP request energy performance preference validity. [0,1]"},
+        {Setting::PkgCstCfgControlCstateLim, "pkg_cst_cfg_control_cstate_limit", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Int, SettingHint::None,
+            "C-State configuration control package C-State limit.\n"
+            "\n"
+            "sandy/ivy bridge possible values:\n"
+            "\t[0] C0/C1 (no package C-sate support)\n"
+            "\t[1] C2\n"
+            "\t[2] C6 no retention\n"
+            "\t[3] C6 retention\n"
+            "\t[4] C7\n"
+            "\t[5] C7s\n"
+            "\t[7] No package C-state limit\n"
+            "\n"
+            "core ultra series possible values:\n"
+            "\t[0] C0/C1 (no package C-sate support)\n"
+            "\t[1] C2\n"
+            "\t[2] C3\n"
+            "\t[3] C6\n"
+            "\t[4] C7\n"
+            "\t[5] C7s\n"
+            "\t[6] C8\n"
+            "\t[7] C9\n"
+            "\t[8] C10"},
+        {Setting::PkgCstCfgControlMaxCoreCstate, "pkg_cst_cfg_control_max_core_cstate", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Int, SettingHint::None,
+            "Max core C-State.\n"
+            "core ultra series possible values:\n"
+            "\t[1] C1\n"
+            "\t[2] C3\n"
+            "\t[3] C6"},
+        {Setting::PkgCstCfgControlIOMWaitRedirectEnable, "pkg_cst_cfg_control_io_mwait_redirection_enable", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Bool, SettingHint::None,
+            "I/O MWAIT redirect enable. [0,1]"},
+        {Setting::PkgCstCfgControlCfgLock, "pkg_cst_cfg_control_cfg_lock_enable", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Bool, SettingHint::None,
+            "Lock C-State limit and I/O MWAIT redirection settings until device reboot. [1,1]"},
+        {Setting::PkgCstCfgControlC3StateAutodemotionEnable, "pkg_cst_cfg_control_c3_autodemotion_enable", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Bool, SettingHint::None,
+            "C3 state auto-demotion enable. [0,1]"},
+        {Setting::PkgCstCfgControlC1StateAutodemotionEnable, "pkg_cst_cfg_control_c1_autodemotion_enable", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Bool, SettingHint::None,
+            "C1 state auto-demotion enable. [0,1]"},
+        {Setting::PkgCstCfgControlC3UndemotionEnable, "pkg_cst_cfg_control_c3_undemotion_enable", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Bool, SettingHint::None,
+            "C3 un-demotion enable. [0,1]"},
+        {Setting::PkgCstCfgControlC1UndemotionEnable, "pkg_cst_cfg_control_c1_undemotion_enable", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Bool, SettingHint::None,
+            "C1 un-demotion enable. [0,1]"},
+        {Setting::PkgCstCfgControlPkgcAutodemotionEnable, "pkg_cst_cfg_control_pkgc_autodemotion_enable", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Bool, SettingHint::None,
+            "Package C-State auto-demotion enable. [0,1]"},
+        {Setting::PkgCstCfgControlPkgcUndemotionEnable, "pkg_cst_cfg_control_pkgc_undemotion_enable", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Bool, SettingHint::None,
+            "Package C-State un-demotion enable. [0,1]"},
+        {Setting::PkgCstCfgControlTimedMwaitEnable, "pkg_cst_cfg_control_timed_mwait_enable", SettingGroup::IntelCPU, SettingScope::Core, SettingType::Bool, SettingHint::None,
+            "Timed MWAIT feature enable. [0,1]"},
+        {Setting::PkgRaplPl1, "pkg_rapl_limit_pl1", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "MCHBAR package power limit PL1 (watts)."},
+        {Setting::PkgRaplPl2, "pkg_rapl_limit_pl2", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "MCHBAR package power limit PL2 (watts)."},
+        {Setting::PkgRaplPl1Enable, "pkg_rapl_limit_pl1_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "MCHBAR package power limit PL1 enable. [0,1]"},
+        {Setting::PkgRaplPl2Enable, "pkg_rapl_limit_pl2_enable", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "MCHBAR package power limit PL2 enable. [0,1]"},
+        {Setting::PkgRaplPl1Time, "pkg_rapl_limit_pl1_time", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "MCHBAR package power limit PL1 time window. [0, 56000]"},
+        {Setting::PkgRaplPl1Clamp, "pkg_rapl_limit_pl1_clamp", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "MCHBAR package power limit PL1 clamp enable. [0,1]"},
+        {Setting::PkgRaplLock, "pkg_rapl_limit_lock", SettingGroup::IntelCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Lock MCHBAR package power limit register until device reboot. [0,1]"},
+#endif
+#ifdef WITH_AMD
+        {Setting::StapmLimit, "stapm_limit", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Skin temperature-aware power management limit (STAPM).\n"
+            "Sustained power limit (watts)."},
+        {Setting::FastLimit, "fast_limit", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Package power tracking fast limit (PPT fast).\n"
+            "Actual power limit (watts)."},
+        {Setting::SlowLimit, "slow_limit", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Package power tracking slow limit (PPT slow).\n"
+            "Average power limit (watts)."},
+        {Setting::TctlTemp, "tctl_temp", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "T control temperature (TCTL).\n"
+            "Thermal limit core (celsius)."},
+        {Setting::ApuSlow, "apu_slow", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Package power tracking APU slow limit (PPT APU).\n"
+            "APU slow power limit for A+A dGPU platform (watts)."},
+        {Setting::ApuSkinTemp, "apu_skin_temp", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Smart temperature tracking APU (STT APU).\n"
+            "APU skin temperature limit (celsius)."},
+        {Setting::DgpuSkinTemp, "dgpu_skin_temp", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Smart temperature tracking dGPU (STT dGPU).\n"
+            "dGPU skin temperature limit (watts)."},
+        {Setting::CurveOptimizer, "co_all", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Curve optimizer offset (All cores)."},
+        {Setting::CurveOptimizerPer, "co_per", SettingGroup::AMDCPU, SettingScope::Core, SettingType::Int, SettingHint::InfoRequest,
+            "Curve optimizer offset."},
+        {Setting::VrmCurrent, "vrm_current", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Thermal Design Current Limit (TDC VDD).\n"
+            "VRM current limit (amps)."},
+        {Setting::VrmSocCurrent, "vrm_soc_current", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Thermal Design Current Limit (TDC SoC).\n"
+            "VRM SoC current limit (amps)."},
+        {Setting::VrmMaxCurrent, "vrm_max_current", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Electrical Design Current Limit (EDC VDD).\n"
+            "VRM maximum current limit (amps)."},
+        {Setting::VrmSocMaxCurrent, "vrm_soc_max_current", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Electrical Design Current Limit (EDC SoC).\n"
+            "VRM SoC maximum current limit (amps)."},
+        {Setting::StaticGfxClk, "static_gfx_clk", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Force static GPU clock (MHz)."},
+        {Setting::MinGfxClk, "min_gfx_clk", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Maximum GPU clock (MHz)."},
+        {Setting::MaxGfxClk, "max_gfx_clk", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::InfoRequest,
+            "Minimum GPU clock (MHz)."},
+        {Setting::AmdPowerProfile, "amd_power_profile", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Int, SettingHint::None,
+            "Power profile. [0 = powersave, 1 = performance]\n"
+            "Hidden option to improve power saving or performance.\n"
+            "Behavior depends on CPU, device and manufacturer."},
+        {Setting::CorePerfBoost, "core_perf_boost_disable", SettingGroup::AMDCPU, SettingScope::Thread, SettingType::Int, SettingHint::None,
+            "Disable core performance boost. [0,1]"},
+        {Setting::PstateCmd, "pstate_cmd", SettingGroup::AMDCPU, SettingScope::Thread, SettingType::Int, SettingHint::DataRequest,
+            "CPU P-State control."},
+        {Setting::CppcEnable, "cppc_enable", SettingGroup::AMDCPU, SettingScope::Global, SettingType::Bool, SettingHint::None,
+            "Enable CPPC. [1,1]"},
+        {Setting::CppcRequestMaxPerf, "cppc_request_max_perf", SettingGroup::AMDCPU, SettingScope::Thread, SettingType::Int, SettingHint::DataRequest,
+            "CPPC request maximum performance."},
+        {Setting::CppcRequestMinPerf, "cppc_request_min_perf", SettingGroup::AMDCPU, SettingScope::Thread, SettingType::Int, SettingHint::DataRequest,
+            "CPPC request minimum performance."},
+        {Setting::CppcRequestDesiredPerf, "cppc_request_desired_perf", SettingGroup::AMDCPU, SettingScope::Thread, SettingType::Int, SettingHint::DataRequest,
+            "CPPC request desired performance."},
+        {Setting::CppcRequestEpp, "cppc_request_epp", SettingGroup::AMDCPU, SettingScope::Thread, SettingType::Int, SettingHint::None,
+            "CPPC request energy performance preference. [0, 255]"},
+#endif
+    }};
+
+    namespace SettingsHash {
+        static constexpr quint32 tableSize = 4096;
+        static constexpr quint32 seedHint = 2; // first perfect seed for all build configurations
+        static constexpr quint32 noSeed = 0xffffffff;
+
+        // FNV-1a
+        [[nodiscard]] constexpr quint32 hash(const std::string_view str, const quint32 seed) {
+            quint32 h = 2166136261u ^ seed;
+
+            for (const char c: str) {
+                h ^= static_cast<unsigned char>(c);
+                h *= 16777619u;
+            }
+
+            return h % tableSize;
+        }
+
+        [[nodiscard]] constexpr bool isPerfect(const quint32 seed) {
+            std::array<bool, tableSize> used {};
+
+            for (const SettingInfo &info: settingsSchema) {
+                const quint32 slot = hash(info.name, seed);
+
+                if (used[slot])
+                    return false;
+
+                used[slot] = true;
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] constexpr quint32 findSeed() {
+            for (quint32 seed=seedHint; seed<seedHint+64; ++seed) {
+                if (isPerfect(seed))
+                    return seed;
+            }
+
+            return noSeed;
+        }
+
+        static constexpr quint32 seed = findSeed();
+        static_assert(seed != noSeed, "no perfect hash seed found for settings, update seedHint");
+
+        [[nodiscard]] constexpr std::array<qint16, tableSize> buildTable() {
+            std::array<qint16, tableSize> table {};
+
+            table.fill(-1);
+
+            for (int i=0; i<settingsCount; ++i)
+                table[hash(settingsSchema[i].name, seed)] = static_cast<qint16>(i);
+
+            return table;
+        }
+
+        static constexpr std::array<qint16, tableSize> table = buildTable();
+    }
+
+    [[nodiscard]] constexpr bool isSettingsSchemaOrdered() {
+        for (int i=0; i<settingsCount; ++i) {
+            if (settingsSchema[i].id != static_cast<Setting>(i))
+                return false;
+        }
+
+        return true;
+    }
+
+    static_assert(isSettingsSchemaOrdered(), "settingsSchema must follow Setting order");
+
+    [[nodiscard]] constexpr const SettingInfo *findSetting(const std::string_view name) {
+        const qint16 idx = SettingsHash::table[SettingsHash::hash(name, SettingsHash::seed)];
+
+        if (idx < 0 || settingsSchema[idx].name != name)
+            return nullptr;
+
+        return &settingsSchema[idx];
+    }
+
+    [[nodiscard]] constexpr const SettingInfo &getSettingInfo(const Setting setting) {
+        return settingsSchema[static_cast<int>(setting)];
+    }
+
+    [[nodiscard]] inline QString settingName(const Setting setting) {
+        const std::string_view name = getSettingInfo(setting).name;
+
+        return QString::fromLatin1(name.data(), static_cast<qsizetype>(name.size()));
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "AsyncService.h"
+
+namespace PWT::CLI {
+    ServiceReply<bool> AsyncService::connectToDaemon(const QString &adr, const quint16 port) const {
+        return {service, [this, adr, port] { service->connectToDaemon(adr, port); }, [this](const ServiceReply<bool>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::serviceConnected, service, [resume] { resume(true); });
+        }};
+    }
+
+    ServiceReply<PWTS::DeviceInfoPacket> AsyncService::deviceInfo() const {
+        return {service, [this] { service->sendGetDeviceInfoPacketRequest(); }, [this](const ServiceReply<PWTS::DeviceInfoPacket>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::deviceInfoPacketReceived, service, [resume](const PWTS::DeviceInfoPacket &packet) { resume(packet); });
+        }};
+    }
+
+    ServiceReply<PWTS::DaemonPacket> AsyncService::daemonPacket() const {
+        return {service, [this] { service->sendGetDaemonPacketRequest(); }, [this](const ServiceReply<PWTS::DaemonPacket>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::daemonPacketReceived, service, [resume](const PWTS::DaemonPacket &packet) { resume(packet); });
+        }};
+    }
+
+    ServiceReply<QSet<PWTS::DError>> AsyncService::applySettings(const PWTS::ClientPacket &packet) const {
+        return {service, [this, packet] { service->sendApplySettingsRequest(packet); }, [this](const ServiceReply<QSet<PWTS::DError>>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::settingsApplied, service, [resume](const QSet<PWTS::DError> &errors) { resume(errors); });
+        }};
+    }
+
+    ServiceReply<QByteArray> AsyncService::daemonSettings() const {
+        return {service, [this] { service->sendGetDaemonSettingsRequest(); }, [this](const ServiceReply<QByteArray>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::daemonSettingsReceived, service, [resume](const QByteArray &data) { resume(data); });
+        }};
+    }
+
+    ServiceReply<bool> AsyncService::applyDaemonSettings(const QByteArray &data) const {
+        return {service, [this, data] { service->sendApplyDaemonSettingsRequest(data); }, [this](const ServiceReply<bool>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::daemonSettingsApplied, service, [resume](const bool diskSaveResult) { resume(diskSaveResult); });
+        }};
+    }
+
+    ServiceReply<QList<QString>> AsyncService::profileList() const {
+        return {service, [this] { service->sendGetProfileListRequest(); }, [this](const ServiceReply<QList<QString>>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::profileListReceived, service, [resume](const QList<QString> &list) { resume(list); });
+        }};
+    }
+
+    ServiceReply<bool> AsyncService::deleteProfile(const QString &name) const {
+        return {service, [this, name] { service->sendDeleteProfileRequest(name); }, [this](const ServiceReply<bool>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::profileDeleted, service, [resume](const bool result) { resume(result); });
+        }};
+    }
+
+    ServiceReply<std::pair<QSet<PWTS::DError>, QString>> AsyncService::applyProfile(const QString &name) const {
+        return {service, [this, name] { service->sendApplyProfileRequest(name); }, [this](const ServiceReply<std::pair<QSet<PWTS::DError>, QString>>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::profileApplied, service, [resume](const QSet<PWTS::DError> &errors, const QString &profile) {
+                resume(std::pair {errors, profile});
+            });
+        }};
+    }
+
+    ServiceReply<bool> AsyncService::writeProfile(const QString &name, const PWTS::ClientPacket &packet) const {
+        return {service, [this, name, packet] { service->sendWriteProfileRequest(name, packet); }, [this](const ServiceReply<bool>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::profileWritten, service, [resume](const bool result) { resume(result); });
+        }};
+    }
+
+    ServiceReply<QHash<QString, QByteArray>> AsyncService::exportProfiles(const QString &name) const {
+        return {service, [this, name] { service->sendExportProfilesRequest(name); }, [this](const ServiceReply<QHash<QString, QByteArray>>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::profilesExported, service, [resume](const QHash<QString, QByteArray> &exported) { resume(exported); });
+        }};
+    }
+
+    ServiceReply<bool> AsyncService::importProfiles(const QHash<QString, QByteArray> &profiles) const {
+        return {service, [this, profiles] { service->sendImportProfilesRequest(profiles); }, [this](const ServiceReply<bool>::Resume &resume) {
+            return QObject::connect(service, &PWTCS::ClientService::profilesImported, service, [resume](const bool result) { resume(result); });
+        }};
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QObject>
+#include <coroutine>
+#include <functional>
+#include <optional>
+
+#include "Task.h"
+#include "pwtClientService/ClientService.h"
+#include "pwtShared/Include/Packets/ClientPacket.h"
+#include "pwtShared/Include/Packets/DaemonPacket.h"
+
+namespace PWT::CLI {
+    // awaitable daemon reply, sends the request when awaited.
+    // no value if the service fails or disconnects before the reply
+    template<typename T>
+    class [[nodiscard]] ServiceReply final {
+    public:
+        using Resume = std::function<void(std::optional<T> &&)>;
+        using Connect = std::function<QMetaObject::Connection(const Resume &)>;
+
+    private:
+        PWTCS::ClientService *service;
+        std::function<void()> request;
+        Connect connectReply;
+        QList<QMetaObject::Connection> connections;
+        std::optional<T> result;
+
+    public:
+        ServiceReply(PWTCS::ClientService *svc, std::function<void()> &&req, Connect &&connect):
+            service(svc), request(std::move(req)), connectReply(std::move(connect)) {}
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        [[nodiscard]] std::optional<T> await_resume() { return std::move(result); }
+
+        void await_suspend(const std::coroutine_handle<> handle) {
+            const Resume resume = [this, handle](std::optional<T> &&value) {
+                for (const QMetaObject::Connection &conn: connections)
+                    QObject::disconnect(conn);
+
+                result = std::move(value);
+                handle.resume(); // this awaiter is gone after resume
+            };
+            const auto fail = [resume] { resume(std::nullopt); };
+
+            connections.append(connectReply(resume));
+            connections.append(QObject::connect(service, &PWTCS::ClientService::serviceError, service, fail));
+            connections.append(QObject::connect(service, &PWTCS::ClientService::commandFailed, service, fail));
+            connections.append(QObject::connect(service, &PWTCS::ClientService::serviceDisconnected, service, fail));
+            request();
+        }
+    };
+
+    // reply as a task, replies are awaited together with whenAll
+    template<typename T>
+    Task<std::optional<T>> replyTask(ServiceReply<T> reply) {
+        co_return co_await reply;
+    }
+
+    // ClientService requests as awaitables, commands are written as coroutines, see Task
+    class AsyncService final {
+    private:
+        PWTCS::ClientService *service;
+
+    public:
+        explicit AsyncService(PWTCS::ClientService *svc): service(svc) {}
+
+        [[nodiscard]] ServiceReply<bool> connectToDaemon(const QString &adr, quint16 port) const;
+        [[nodiscard]] ServiceReply<PWTS::DeviceInfoPacket> deviceInfo() const;
+        [[nodiscard]] ServiceReply<PWTS::DaemonPacket> daemonPacket() const;
+        [[nodiscard]] ServiceReply<QSet<PWTS::DError>> applySettings(const PWTS::ClientPacket &packet) const;
+        [[nodiscard]] ServiceReply<QByteArray> daemonSettings() const;
+        [[nodiscard]] ServiceReply<bool> applyDaemonSettings(const QByteArray &data) const;
+        [[nodiscard]] ServiceReply<QList<QString>> profileList() const;
+        [[nodiscard]] ServiceReply<bool> deleteProfile(const QString &name) const;
+        [[nodiscard]] ServiceReply<std::pair<QSet<PWTS::DError>, QString>> applyProfile(const QString &name) const;
+        [[nodiscard]] ServiceReply<bool> writeProfile(const QString &name, const PWTS::ClientPacket &packet) const;
+        [[nodiscard]] ServiceReply<QHash<QString, QByteArray>> exportProfiles(const QString &name) const;
+        [[nodiscard]] ServiceReply<bool> importProfiles(const QHash<QString, QByteArray> &profiles) const;
+    };
+}
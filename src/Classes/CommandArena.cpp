@@ -0,0 +1,43 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "CommandArena.h"
+
+namespace PWT::CLI {
+    void *CommandArena::HeapResource::do_allocate(const size_t size, const size_t alignment) {
+        ++allocations;
+        bytes += size;
+
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+
+    void CommandArena::HeapResource::do_deallocate(void *ptr, const size_t size, const size_t alignment) {
+        std::pmr::new_delete_resource()->deallocate(ptr, size, alignment);
+    }
+
+    CommandArena::CommandArena(): monotonic(buffer.data(), buffer.size(), &heap) {}
+
+    void *CommandArena::do_allocate(const size_t size, const size_t alignment) {
+        ++allocations;
+        bytes += size;
+
+        return monotonic.allocate(size, alignment);
+    }
+
+    // memory is given back when the arena is destroyed
+    void CommandArena::do_deallocate(void *, size_t, size_t) {}
+}
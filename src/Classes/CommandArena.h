@@ -0,0 +1,68 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QtTypes>
+#include <array>
+#include <memory_resource>
+
+namespace PWT::CLI {
+    // monotonic memory for the transient data of a single command, released all at once.
+    // not thread safe, allocate from the command thread while parsing and resolving settings
+    class CommandArena final: public std::pmr::memory_resource {
+    public:
+        struct Stats final {
+            quint64 allocations = 0;
+            quint64 bytes = 0;
+            quint64 heapAllocations = 0; // chunks requested by the arena
+            quint64 heapBytes = 0;
+        };
+
+    private:
+        static constexpr size_t inlineSize = 8192;
+
+        // counts and forwards the arena chunks to the heap
+        class HeapResource final: public std::pmr::memory_resource {
+        public:
+            quint64 allocations = 0;
+            quint64 bytes = 0;
+
+        private:
+            void *do_allocate(size_t size, size_t alignment) override;
+            void do_deallocate(void *ptr, size_t size, size_t alignment) override;
+            [[nodiscard]] bool do_is_equal(const memory_resource &other) const noexcept override { return this == &other; }
+        };
+
+        alignas(std::max_align_t) std::array<std::byte, inlineSize> buffer;
+        HeapResource heap;
+        std::pmr::monotonic_buffer_resource monotonic;
+        quint64 allocations = 0;
+        quint64 bytes = 0;
+
+        void *do_allocate(size_t size, size_t alignment) override;
+        void do_deallocate(void *ptr, size_t size, size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const memory_resource &other) const noexcept override { return this == &other; }
+
+    public:
+        CommandArena();
+        CommandArena(const CommandArena &) = delete;
+        CommandArena &operator=(const CommandArena &) = delete;
+
+        [[nodiscard]] Stats stats() const { return {allocations, bytes, heap.allocations, heap.bytes}; }
+    };
+}
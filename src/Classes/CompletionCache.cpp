@@ -0,0 +1,316 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QTextStream>
+
+#include "CompletionCache.h"
+
+namespace PWT::CLI {
+    struct SettingFeature final {
+        Setting setting;
+        SettingFeatures features;
+    };
+
+    struct SettingValues final {
+        Setting setting;
+        std::string_view values;
+    };
+
+    // features of the os and gpu settings, cpu vendor settings are listed by their helper registries
+    // settings not listed are available when their group applies to the device
+    static constexpr std::array settingFeatures {
+        SettingFeature {Setting::SmtState, {PWTS::Feature::SYSFS_GROUP, PWTS::Feature::CPU_SMT_SYSFS}},
+        SettingFeature {Setting::CpuIdleGovernor, {PWTS::Feature::SYSFS_GROUP, PWTS::Feature::CPUIDLE_GOV_SYSFS}},
+        SettingFeature {Setting::CpuMinFreq, {PWTS::Feature::SYSFS_GROUP, PWTS::Feature::CPUFREQ_SYSFS}},
+        SettingFeature {Setting::CpuMaxFreq, {PWTS::Feature::SYSFS_GROUP, PWTS::Feature::CPUFREQ_SYSFS}},
+        SettingFeature {Setting::CpuScalingGovernor, {PWTS::Feature::SYSFS_GROUP, PWTS::Feature::CPUFREQ_SYSFS}},
+        SettingFeature {Setting::CpuStatus, {PWTS::Feature::SYSFS_GROUP, PWTS::Feature::CPU_PARK_SYSFS}},
+#ifdef WITH_AMD
+        SettingFeature {Setting::PstateStatus, {PWTS::Feature::SYSFS_GROUP, PWTS::Feature::AMD_PSTATE_SYSFS}},
+        SettingFeature {Setting::PstateEpp, {PWTS::Feature::SYSFS_GROUP, PWTS::Feature::AMD_PSTATE_SYSFS}},
+#endif
+        SettingFeature {Setting::GpuRpsMinFreq, {PWTS::Feature::INTEL_GPU_SYSFS_GROUP, PWTS::Feature::INTEL_GPU_RPS_FREQ_SYSFS}},
+        SettingFeature {Setting::GpuRpsMaxFreq, {PWTS::Feature::INTEL_GPU_SYSFS_GROUP, PWTS::Feature::INTEL_GPU_RPS_FREQ_SYSFS}},
+        SettingFeature {Setting::GpuRpsMaxBoost, {PWTS::Feature::INTEL_GPU_SYSFS_GROUP, PWTS::Feature::INTEL_GPU_BOOST_SYSFS}},
+        SettingFeature {Setting::PowerDpmState, {PWTS::Feature::AMD_GPU_SYSFS_GROUP, PWTS::Feature::AMD_GPU_POWER_DPM_STATE_SYSFS}},
+        SettingFeature {Setting::PowerDpmForcePerfLvl, {PWTS::Feature::AMD_GPU_SYSFS_GROUP, PWTS::Feature::AMD_GPU_DPM_FORCE_PERF_LEVEL_SYSFS}},
+        SettingFeature {Setting::PowerDpmForcePerfMinSclk, {PWTS::Feature::AMD_GPU_SYSFS_GROUP, PWTS::Feature::AMD_GPU_DPM_FORCE_PERF_LEVEL_SYSFS}},
+        SettingFeature {Setting::PowerDpmForcePerfMaxSclk, {PWTS::Feature::AMD_GPU_SYSFS_GROUP, PWTS::Feature::AMD_GPU_DPM_FORCE_PERF_LEVEL_SYSFS}},
+        SettingFeature {Setting::PowerDpmForcePerfReset, {PWTS::Feature::AMD_GPU_SYSFS_GROUP, PWTS::Feature::AMD_GPU_DPM_FORCE_PERF_LEVEL_SYSFS}},
+        SettingFeature {Setting::PowerScheme, {PWTS::Feature::PWR_SCHEME_GROUP, PWTS::Feature::PWR_SCHEME_GROUP}},
+    };
+
+    // fixed values of string settings, the others are read from the daemon packet
+    static constexpr std::array settingStaticValues {
+        SettingValues {Setting::SmtState, "on off forceoff"},
+        SettingValues {Setting::MiscPmDevs, "auto on"},
+#ifdef WITH_AMD
+        SettingValues {Setting::PstateStatus, "disable active passive guided"},
+#endif
+        SettingValues {Setting::PowerDpmState, "battery balanced performance"},
+        SettingValues {Setting::PowerDpmForcePerfLvl, "auto low high manual profile_standard profile_min_sclk profile_min_mclk profile_peak"}
+    };
+
+    [[nodiscard]]
+    static bool isGroupAvailable(const SettingGroup group, const PWTS::DaemonPacket &packet) {
+        switch (group) {
+            case SettingGroup::LinuxSysfs:
+            case SettingGroup::LinuxIntelGPU:
+            case SettingGroup::LinuxAMDGPU:
+                return packet.os == PWTS::OSType::Linux && !packet.linuxData.isNull();
+#ifdef WITH_AMD
+            case SettingGroup::LinuxAMD:
+                return packet.os == PWTS::OSType::Linux && packet.vendor == PWTS::CPUVendor::AMD && !packet.linuxAmdData.isNull();
+            case SettingGroup::AMDCPU:
+                return packet.vendor == PWTS::CPUVendor::AMD && !packet.amdData.isNull();
+#endif
+#ifdef WITH_INTEL
+            case SettingGroup::IntelCPU:
+                return packet.vendor == PWTS::CPUVendor::Intel && !packet.intelData.isNull();
+#endif
+            case SettingGroup::Windows:
+                return packet.os == PWTS::OSType::Windows && !packet.windowsData.isNull();
+            case SettingGroup::FanControl:
+                return !packet.fanData.isEmpty();
+            default:
+                return false;
+        }
+    }
+
+    [[nodiscard]]
+    static bool isSettingAvailable(const SettingInfo &info, const PWTS::DaemonPacket &packet, const FeatureSet &features, const QMap<Setting, SettingFeatures> &settingsFeatures) {
+        if (!isGroupAvailable(info.group, packet))
+            return false;
+
+        if (settingsFeatures.contains(info.id)) {
+            const SettingFeatures sf = settingsFeatures.value(info.id);
+
+            if (info.scope == SettingScope::GPU)
+                return features.anyGPU(sf.group) && features.anyGPU(sf.feature);
+
+            if (!features.cpu(sf.group) || !features.cpu(sf.feature))
+                return false;
+        }
+
+        switch (info.id) {
+            case Setting::BlockDevQueSched:
+                return !packet.linuxData->blockDevicesQueSched.isEmpty();
+            case Setting::MiscPmDevs:
+                return !packet.linuxData->miscPMDevices.isEmpty();
+#ifdef WITH_INTEL
+            case Setting::EnergyPerfBias: // replaced by hwp epp when available
+                return !features.cpu(PWTS::Feature::INTEL_HWP_EPP);
+#endif
+            default:
+                return true;
+        }
+    }
+
+    static void appendValues(QList<QString> &list, const QList<QString> &values) {
+        for (const QString &val: values) {
+            if (!val.isEmpty() && !list.contains(val))
+                list.append(val);
+        }
+    }
+
+    CompletionCache::CompletionCache(const QString &appDataPath) {
+        if (!appDataPath.isEmpty())
+            path = QString("%1/completion").arg(appDataPath);
+    }
+
+    QString CompletionCache::getFilePath(const QString &daemon) const {
+        // the daemon name is the file name, shells must be able to use it as is
+        if (path.isEmpty() || daemon.isEmpty() || daemon.front() == '.')
+            return {};
+
+        for (const QChar ch: daemon) {
+            if (ch.isSpace() || ch == '/' || ch == '\\' || ch == ';')
+                return {};
+        }
+
+        return QString("%1/%2").arg(path, daemon);
+    }
+
+    DeviceCapabilities CompletionCache::getCapabilities(const PWTS::DaemonPacket &packet, const FeatureSet &features,
+                                                        const QMap<Setting, SettingFeatures> &vendorFeatures, const QMap<Setting, SettingBounds> &ranges) {
+        QMap<Setting, SettingFeatures> settingsFeatures = vendorFeatures;
+        std::array<QList<QString>, settingsCount> values;
+        DeviceCapabilities caps;
+
+        for (const SettingFeature &sf: settingFeatures)
+            settingsFeatures.insert(sf.setting, sf.features);
+
+        for (const SettingValues &sv: settingStaticValues)
+            values[static_cast<int>(sv.setting)] = QString::fromLatin1(sv.values.data(), static_cast<qsizetype>(sv.values.size())).split(' ');
+
+        if (packet.os == PWTS::OSType::Linux && !packet.linuxData.isNull()) {
+            QList<QString> &scalingGovs = values[static_cast<int>(Setting::CpuScalingGovernor)];
+            QList<QString> &queScheds = values[static_cast<int>(Setting::BlockDevQueSched)];
+
+            for (const PWTS::LNX::LinuxThreadData &thd: packet.linuxData->threadData) {
+                if (thd.scalingAvailableGovernors.isValid())
+                    appendValues(scalingGovs, thd.scalingAvailableGovernors.getValue().availableGovernors);
+            }
+
+            for (const auto &devData: packet.linuxData->blockDevicesQueSched)
+                appendValues(queScheds, devData.availableQueueSchedulers);
+
+            if (packet.linuxData->cpuIdleAvailableGovernors.isValid())
+                appendValues(values[static_cast<int>(Setting::CpuIdleGovernor)], packet.linuxData->cpuIdleAvailableGovernors.getValue());
+        }
+#ifdef WITH_AMD
+        if (packet.os == PWTS::OSType::Linux && !packet.linuxAmdData.isNull()) {
+            QList<QString> &eppPrefs = values[static_cast<int>(Setting::PstateEpp)];
+
+            for (const PWTS::LNX::AMD::LinuxAMDThreadData &thd: packet.linuxAmdData->threadData) {
+                if (thd.pstateData.isValid())
+                    appendValues(eppPrefs, thd.pstateData.getValue().eppAvailablePrefs);
+            }
+        }
+#endif
+
+        for (const SettingInfo &info: settingsSchema) {
+            const QString name = settingName(info.id);
+            const QList<QString> &settingValues = values[static_cast<int>(info.id)];
+
+            if (!isSettingAvailable(info, packet, features, settingsFeatures))
+                continue;
+
+            caps.settings.insert(name);
+
+            if (info.type == SettingType::Bool)
+                caps.values.insert(name, {"0", "1"});
+            else if (!settingValues.isEmpty())
+                caps.values.insert(name, settingValues);
+
+            if (ranges.contains(info.id))
+                caps.ranges.insert(name, ranges.value(info.id));
+        }
+
+        return caps;
+    }
+
+    bool CompletionCache::write(const QString &daemon, const DeviceCapabilities &capabilities) const {
+        const QString filePath = getFilePath(daemon);
+        QList<QString> settings;
+
+        if (filePath.isEmpty() || !QDir().mkpath(path))
+            return false;
+
+        for (const SettingInfo &info: settingsSchema) {
+            if (capabilities.settings.contains(settingName(info.id)))
+                settings.append(settingName(info.id) + (info.scope == SettingScope::Global ? "=" : "["));
+        }
+
+        QSaveFile cacheF {filePath};
+
+        if (!cacheF.open(QFile::WriteOnly | QFile::Text))
+            return false;
+
+        QTextStream ts(&cacheF);
+
+        ts << "settings " << settings.join(' ') << "\n";
+
+        // same order as the schema
+        for (const SettingInfo &info: settingsSchema) {
+            const auto settingValues = capabilities.values.constFind(settingName(info.id));
+
+            if (settingValues != capabilities.values.constEnd())
+                ts << settingName(info.id) << " " << settingValues->join(' ') << "\n";
+        }
+
+        for (const SettingInfo &info: settingsSchema) {
+            const auto bounds = capabilities.ranges.constFind(settingName(info.id));
+
+            if (bounds != capabilities.ranges.constEnd())
+                ts << "range " << settingName(info.id) << " " << bounds->min << " " << bounds->max << "\n";
+        }
+
+        ts.flush();
+        return cacheF.commit();
+    }
+
+    std::optional<DeviceCapabilities> CompletionCache::read(const QString &daemon) const {
+        const QString filePath = getFilePath(daemon);
+        DeviceCapabilities caps;
+        bool hasSettings = false;
+
+        if (filePath.isEmpty())
+            return std::nullopt;
+
+        QFile cacheF {filePath};
+
+        if (!cacheF.open(QFile::ReadOnly | QFile::Text))
+            return std::nullopt;
+
+        QTextStream ts(&cacheF);
+        QString line;
+
+        while (ts.readLineInto(&line)) {
+            QList<QString> values = line.split(' ', Qt::SkipEmptyParts);
+
+            if (values.isEmpty())
+                continue;
+
+            const QString key = values.takeFirst();
+
+            if (key == "settings") {
+                for (const QString &name: values)
+                    caps.settings.insert(name.chopped(1));
+
+                hasSettings = true;
+
+            } else if (key == "range") {
+                bool minOk, maxOk;
+
+                if (values.size() != 3)
+                    continue;
+
+                const SettingBounds bounds {values[1].toInt(&minOk), values[2].toInt(&maxOk)};
+
+                if (minOk && maxOk)
+                    caps.ranges.insert(values[0], bounds);
+
+            } else {
+                caps.values.insert(key, values);
+            }
+        }
+
+        if (!hasSettings)
+            return std::nullopt;
+
+        return caps;
+    }
+
+    QSet<QString> CompletionCache::readSettings(const QString &daemon) const {
+        const std::optional<DeviceCapabilities> capabilities = read(daemon);
+
+        return capabilities ? capabilities->settings : QSet<QString> {};
+    }
+
+    void CompletionCache::remove(const QList<QString> &daemons) const {
+        for (const QString &daemon: daemons) {
+            const QString filePath = getFilePath(daemon);
+
+            if (!filePath.isEmpty())
+                QFile::remove(filePath);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QSet>
+#include <QMap>
+#include <optional>
+
+#include "FeatureSet.h"
+#include "../CMDParser/SettingsSchema.h"
+#include "pwtShared/Include/Packets/DaemonPacket.h"
+
+namespace PWT::CLI {
+    // supported settings and accepted values of a daemon, by setting name
+    struct DeviceCapabilities final {
+        QSet<QString> settings;
+        QHash<QString, QList<QString>> values;
+        QHash<QString, SettingBounds> ranges;
+    };
+
+    // per daemon capabilities for shell completion, read by the scripts without starting the CLI
+    // one line per key, space separated values:
+    //  settings <name= or name[ for each supported setting>
+    //  <setting name> <accepted values>
+    //  range <setting name> <min> <max>
+    class CompletionCache final {
+    private:
+        QString path;
+
+        [[nodiscard]] QString getFilePath(const QString &daemon) const;
+
+    public:
+        explicit CompletionCache(const QString &appDataPath);
+
+        [[nodiscard]] QString getPath() const { return path; }
+        // capabilities of a connected daemon, as written to its cache file
+        [[nodiscard]] static DeviceCapabilities getCapabilities(const PWTS::DaemonPacket &packet, const FeatureSet &features,
+                                                                const QMap<Setting, SettingFeatures> &vendorFeatures, const QMap<Setting, SettingBounds> &ranges);
+
+        [[nodiscard]] bool write(const QString &daemon, const DeviceCapabilities &capabilities) const;
+        [[nodiscard]] std::optional<DeviceCapabilities> read(const QString &daemon) const;
+        [[nodiscard]] QSet<QString> readSettings(const QString &daemon) const;
+        void remove(const QList<QString> &daemons) const;
+    };
+}
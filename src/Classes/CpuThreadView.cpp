@@ -0,0 +1,190 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "CpuThreadView.h"
+
+namespace PWT::CLI {
+    CpuThreadView::CpuThreadView(const PWTS::DaemonPacket &packet) {
+        qsizetype threads = packet.linuxData.isNull() ? 0 : packet.linuxData->threadData.size();
+
+#ifdef WITH_INTEL
+        if (!packet.intelData.isNull())
+            threads = qMax(threads, packet.intelData->threadData.size());
+#endif
+#ifdef WITH_AMD
+        if (!packet.amdData.isNull())
+            threads = qMax(threads, packet.amdData->threadData.size());
+
+        if (!packet.linuxAmdData.isNull())
+            threads = qMax(threads, packet.linuxAmdData->threadData.size());
+#endif
+
+        count = threads;
+
+        // one sequential pass over each thread data list
+        if (!packet.linuxData.isNull()) {
+            resizeColumns(freqMin, freqMax, freqLimitMin, freqLimitMax, scalingGovernor, onlineStatus, coreID);
+
+            for (qsizetype i=0,l=packet.linuxData->threadData.size(); i<l; ++i)
+                setLinuxThread(i, packet.linuxData->threadData[i]);
+        }
+#ifdef WITH_INTEL
+        if (!packet.intelData.isNull()) {
+            resizeColumns(hwpMin, hwpMax, hwpDesired, hwpAcw, hwpEpp, hwpPkgControl);
+
+            for (qsizetype i=0,l=packet.intelData->threadData.size(); i<l; ++i)
+                setIntelThread(i, packet.intelData->threadData[i]);
+        }
+#endif
+#ifdef WITH_AMD
+        if (!packet.amdData.isNull()) {
+            resizeColumns(pstateCmd, corePerfBoost, cppcMin, cppcMax, cppcDesired, cppcEpp);
+
+            for (qsizetype i=0,l=packet.amdData->threadData.size(); i<l; ++i)
+                setAMDThread(i, packet.amdData->threadData[i]);
+        }
+
+        if (!packet.linuxAmdData.isNull()) {
+            resizeColumns(pstateEpp);
+
+            for (qsizetype i=0,l=packet.linuxAmdData->threadData.size(); i<l; ++i)
+                setLinuxAMDThread(i, packet.linuxAmdData->threadData[i]);
+        }
+#endif
+    }
+
+    CpuThreadView CpuThreadView::frequencyView(const qsizetype threads) {
+        CpuThreadView view;
+
+        view.count = threads;
+        view.resizeColumns(view.freqMin, view.freqMax, view.freqLimitMin, view.freqLimitMax);
+        return view;
+    }
+
+#ifdef WITH_INTEL
+    CpuThreadView CpuThreadView::hwpView(const qsizetype threads) {
+        CpuThreadView view;
+
+        view.count = threads;
+        view.resizeColumns(view.hwpMin, view.hwpMax, view.hwpDesired, view.hwpAcw, view.hwpEpp, view.hwpPkgControl, view.hwpLowest, view.hwpHighest);
+        return view;
+    }
+#endif
+
+#ifdef WITH_AMD
+    CpuThreadView CpuThreadView::cppcView(const qsizetype threads) {
+        CpuThreadView view;
+
+        view.count = threads;
+        view.resizeColumns(view.cppcMin, view.cppcMax, view.cppcDesired, view.cppcEpp, view.cppcLowest, view.cppcHighest);
+        return view;
+    }
+#endif
+
+    void CpuThreadView::setLinuxFrequency(const qsizetype idx, const PWTS::LNX::LinuxThreadData &data) {
+        if (data.cpuFrequency.isValid()) {
+            const PWTS::MinMax freq = data.cpuFrequency.getValue();
+
+            freqMin.values[idx] = freq.min;
+            freqMax.values[idx] = freq.max;
+            freqMin.valid[idx] = freqMax.valid[idx] = true;
+        }
+
+        if (data.cpuFrequencyLimits.isValid()) {
+            const PWTS::MinMax limits = data.cpuFrequencyLimits.getValue().limit;
+
+            freqLimitMin.values[idx] = limits.min;
+            freqLimitMax.values[idx] = limits.max;
+            freqLimitMin.valid[idx] = freqLimitMax.valid[idx] = true;
+        }
+    }
+
+    void CpuThreadView::setLinuxThread(const qsizetype idx, const PWTS::LNX::LinuxThreadData &data) {
+        setLinuxFrequency(idx, data);
+        scalingGovernor.set(idx, data.scalingGovernor);
+        onlineStatus.set(idx, data.cpuOnlineStatus);
+        coreID.set(idx, data.coreID);
+    }
+
+#ifdef WITH_INTEL
+    void CpuThreadView::setIntelThread(const qsizetype idx, const PWTS::Intel::IntelThreadData &data) {
+        if (!data.hwpRequest.isValid())
+            return;
+
+        const PWTS::Intel::HWPRequest req = data.hwpRequest.getValue();
+
+        hwpMin.values[idx] = req.requestPkg.min;
+        hwpMax.values[idx] = req.requestPkg.max;
+        hwpDesired.values[idx] = req.requestPkg.desired;
+        hwpAcw.values[idx] = req.requestPkg.acw;
+        hwpEpp.values[idx] = req.requestPkg.epp;
+        hwpPkgControl.values[idx] = req.packageControl;
+        hwpMin.valid[idx] = hwpMax.valid[idx] = hwpDesired.valid[idx] = hwpAcw.valid[idx] = hwpEpp.valid[idx] = hwpPkgControl.valid[idx] = true;
+    }
+
+    void CpuThreadView::setIntelHwp(const qsizetype idx, const PWTS::Intel::IntelThreadData &data) {
+        setIntelThread(idx, data);
+
+        if (!data.hwpCapapabilities.isValid())
+            return;
+
+        const PWTS::Intel::HWPCapabilities caps = data.hwpCapapabilities.getValue();
+
+        hwpLowest.values[idx] = caps.lowestPerf;
+        hwpHighest.values[idx] = caps.highestPerf;
+        hwpLowest.valid[idx] = hwpHighest.valid[idx] = true;
+    }
+#endif
+
+#ifdef WITH_AMD
+    void CpuThreadView::setAMDThread(const qsizetype idx, const PWTS::AMD::AMDThreadData &data) {
+        pstateCmd.set(idx, data.pstateCmd);
+        corePerfBoost.set(idx, data.corePerfBoost);
+        setCppcRequest(idx, data);
+    }
+
+    void CpuThreadView::setAMDCppc(const qsizetype idx, const PWTS::AMD::AMDThreadData &data) {
+        setCppcRequest(idx, data);
+
+        if (!data.cppcCapability1.isValid())
+            return;
+
+        const PWTS::AMD::CPPCCapability1 caps = data.cppcCapability1.getValue();
+
+        cppcLowest.values[idx] = caps.lowestPerf;
+        cppcHighest.values[idx] = caps.highestPerf;
+        cppcLowest.valid[idx] = cppcHighest.valid[idx] = true;
+    }
+
+    void CpuThreadView::setCppcRequest(const qsizetype idx, const PWTS::AMD::AMDThreadData &data) {
+        if (!data.cppcRequest.isValid())
+            return;
+
+        const PWTS::AMD::CPPCRequest req = data.cppcRequest.getValue();
+
+        cppcMin.values[idx] = req.minPerf;
+        cppcMax.values[idx] = req.maxPerf;
+        cppcDesired.values[idx] = req.desPerf;
+        cppcEpp.values[idx] = req.epp;
+        cppcMin.valid[idx] = cppcMax.valid[idx] = cppcDesired.valid[idx] = cppcEpp.valid[idx] = true;
+    }
+
+    void CpuThreadView::setLinuxAMDThread(const qsizetype idx, const PWTS::LNX::AMD::LinuxAMDThreadData &data) {
+        pstateEpp.set(idx, data.epp);
+    }
+#endif
+}
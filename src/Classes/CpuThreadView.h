@@ -0,0 +1,112 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "pwtShared/Include/Packets/DaemonPacket.h"
+
+namespace PWT::CLI {
+    // one entry per cpu, invalid or missing data is 0 with its valid flag cleared
+    template<typename T>
+    struct ThreadColumn final {
+        QList<T> values;
+        QList<bool> valid;
+
+        void resize(const qsizetype count) {
+            values.resize(count);
+            valid.resize(count);
+        }
+
+        template<typename D>
+        void set(const qsizetype idx, const D &data) {
+            if (!data.isValid())
+                return;
+
+            values[idx] = static_cast<T>(data.getValue());
+            valid[idx] = true;
+        }
+    };
+
+    // per-thread packet data as contiguous columns,
+    // loops over all cpus read arrays instead of walking the thread data structs for each field.
+    // only the columns of the data in the packet are sized
+    class CpuThreadView final {
+    private:
+        template<typename... C>
+        void resizeColumns(C &...columns) const { (columns.resize(count), ...); }
+
+#ifdef WITH_AMD
+        void setCppcRequest(qsizetype idx, const PWTS::AMD::AMDThreadData &data);
+#endif
+
+    public:
+        qsizetype count = 0;
+        ThreadColumn<int> freqMin;
+        ThreadColumn<int> freqMax;
+        ThreadColumn<int> freqLimitMin;
+        ThreadColumn<int> freqLimitMax;
+        ThreadColumn<QString> scalingGovernor;
+        ThreadColumn<int> onlineStatus;
+        ThreadColumn<int> coreID;
+#ifdef WITH_INTEL
+        ThreadColumn<int> hwpMin;
+        ThreadColumn<int> hwpMax;
+        ThreadColumn<int> hwpDesired;
+        ThreadColumn<int> hwpAcw;
+        ThreadColumn<int> hwpEpp;
+        ThreadColumn<int> hwpPkgControl;
+        ThreadColumn<int> hwpLowest; // capabilities, hwpView only
+        ThreadColumn<int> hwpHighest;
+#endif
+#ifdef WITH_AMD
+        ThreadColumn<int> pstateCmd;
+        ThreadColumn<int> corePerfBoost;
+        ThreadColumn<int> cppcMin;
+        ThreadColumn<int> cppcMax;
+        ThreadColumn<int> cppcDesired;
+        ThreadColumn<int> cppcEpp;
+        ThreadColumn<int> cppcLowest; // capabilities, cppcView only
+        ThreadColumn<int> cppcHighest;
+        ThreadColumn<QString> pstateEpp;
+#endif
+
+        CpuThreadView() = default;
+        explicit CpuThreadView(const PWTS::DaemonPacket &packet);
+
+        // views of the columns a helper clamps and compares, filled by setLinuxFrequency, setIntelHwp and setAMDCppc
+        [[nodiscard]] static CpuThreadView frequencyView(qsizetype threads);
+#ifdef WITH_INTEL
+        [[nodiscard]] static CpuThreadView hwpView(qsizetype threads);
+#endif
+#ifdef WITH_AMD
+        [[nodiscard]] static CpuThreadView cppcView(qsizetype threads);
+#endif
+
+        // fill the entry of a cpu, safe to call for different indexes in parallel
+        void setLinuxFrequency(qsizetype idx, const PWTS::LNX::LinuxThreadData &data);
+        void setLinuxThread(qsizetype idx, const PWTS::LNX::LinuxThreadData &data);
+#ifdef WITH_INTEL
+        void setIntelThread(qsizetype idx, const PWTS::Intel::IntelThreadData &data);
+        void setIntelHwp(qsizetype idx, const PWTS::Intel::IntelThreadData &data);
+#endif
+#ifdef WITH_AMD
+        void setAMDThread(qsizetype idx, const PWTS::AMD::AMDThreadData &data);
+        void setAMDCppc(qsizetype idx, const PWTS::AMD::AMDThreadData &data);
+        void setLinuxAMDThread(qsizetype idx, const PWTS::LNX::AMD::LinuxAMDThreadData &data);
+#endif
+    };
+}
@@ -0,0 +1,70 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <QSet>
+
+#include "CpuTopology.h"
+
+namespace PWT::CLI {
+    CpuTopology::CpuTopology(const PWTS::DaemonPacket &packet, const int coreCount) {
+        if (packet.os != PWTS::OSType::Linux || packet.linuxData.isNull())
+            return;
+
+        QSet<int> seen;
+
+        for (const PWTS::LNX::LinuxThreadData &thd: packet.linuxData->threadData) {
+            if (!thd.coreID.isValid()) {
+                threadCoreIDs.clear();
+                return;
+            }
+
+            const int coreID = thd.coreID.getValue();
+
+            threadCoreIDs.append(coreID);
+            seen.insert(coreID);
+        }
+
+        // linux core_id restarts on each package and package ids are not sent,
+        // cores are only told apart when every core has its own id
+        if (seen.size() != coreCount)
+            threadCoreIDs.clear();
+    }
+
+    bool CpuTopology::hasGroup(const TopologyGroup group) const {
+        return group == TopologyGroup::SmtSiblings && isValid();
+    }
+
+    QList<int> CpuTopology::getThreads(const TopologyGroup group) const {
+        QSet<int> seen;
+        QList<int> threads;
+
+        if (!hasGroup(group))
+            return threads;
+
+        // every thread of a core but its first one
+        for (int i=0,l=threadCoreIDs.size(); i<l; ++i) {
+            const int coreID = threadCoreIDs[i];
+
+            if (seen.contains(coreID))
+                threads.append(i);
+            else
+                seen.insert(coreID);
+        }
+
+        return threads;
+    }
+}
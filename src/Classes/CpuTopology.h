@@ -0,0 +1,44 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QHash>
+#include <QList>
+
+#include "pwtShared/Include/Packets/DaemonPacket.h"
+
+namespace PWT::CLI {
+    // core type and L3 groups are left out until the daemon reports them
+    enum struct TopologyGroup: int {
+        None,
+        SmtSiblings
+    };
+
+    // cpu topology from per thread core ids reported by the daemon
+    class CpuTopology final {
+    private:
+        QList<int> threadCoreIDs;
+
+    public:
+        CpuTopology(const PWTS::DaemonPacket &packet, int coreCount);
+
+        [[nodiscard]] bool isValid() const { return !threadCoreIDs.isEmpty(); }
+        [[nodiscard]] bool hasGroup(TopologyGroup group) const;
+        [[nodiscard]] QList<int> getThreads(TopologyGroup group) const;
+    };
+}
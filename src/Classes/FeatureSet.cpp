@@ -0,0 +1,53 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+
+#include "FeatureSet.h"
+
+namespace PWT::CLI {
+    FeatureSet::FeatureSet(const PWTS::Features &features) {
+        cpuBits = toBits(features.cpu);
+        fans = !features.fans.isEmpty();
+
+        for (const auto &[idx, gpu]: features.gpus.asKeyValueRange())
+            gpuBits.insert(idx, toBits(gpu.second));
+    }
+
+    QBitArray FeatureSet::toBits(const QSet<PWTS::Feature> &features) {
+        int size = 0;
+
+        for (const PWTS::Feature feature: features)
+            size = std::max(size, static_cast<int>(feature) + 1);
+
+        QBitArray bits(size);
+
+        for (const PWTS::Feature feature: features)
+            bits.setBit(static_cast<int>(feature));
+
+        return bits;
+    }
+
+    bool FeatureSet::anyGPU(const PWTS::Feature feature) const {
+        for (const QBitArray &bits: gpuBits) {
+            if (test(bits, feature))
+                return true;
+        }
+
+        return false;
+    }
+}
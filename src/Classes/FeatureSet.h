@@ -0,0 +1,69 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QBitArray>
+#include <QMap>
+#include <array>
+
+#include "pwtShared/Include/Features.h"
+
+namespace PWT::CLI {
+    // features that share an input range or a section
+    namespace FeatureGroup {
+        static constexpr std::array ryzenAdjPowerLimitW {PWTS::Feature::AMD_RY_SLOW_LIMIT_W, PWTS::Feature::AMD_RY_FAST_LIMIT_W, PWTS::Feature::AMD_RY_STAPM_LIMIT_W};
+        static constexpr std::array ryzenAdjGfxClockW {PWTS::Feature::AMD_RY_STATIC_GFX_CLK_W, PWTS::Feature::AMD_RY_MIN_GFX_CLOCK_W, PWTS::Feature::AMD_RY_MAX_GFX_CLOCK_W};
+        static constexpr std::array ryzenAdjCurveOptimizerW {PWTS::Feature::AMD_RY_CO_ALL_W, PWTS::Feature::AMD_RY_CO_PER_W};
+    }
+
+    // daemon features as bit sets, built once from the device info packet.
+    // read only, copies share the same data
+    class FeatureSet final {
+    private:
+        QBitArray cpuBits;
+        QMap<int, QBitArray> gpuBits;
+        bool fans = false;
+
+        [[nodiscard]] static QBitArray toBits(const QSet<PWTS::Feature> &features);
+        [[nodiscard]] static bool test(const QBitArray &bits, const PWTS::Feature feature) {
+            const int bit = static_cast<int>(feature);
+
+            return bit < bits.size() && bits.testBit(bit);
+        }
+
+    public:
+        FeatureSet() = default;
+        explicit FeatureSet(const PWTS::Features &features);
+
+        [[nodiscard]] bool cpu(const PWTS::Feature feature) const { return test(cpuBits, feature); }
+        [[nodiscard]] bool gpu(const int idx, const PWTS::Feature feature) const { return test(gpuBits.value(idx), feature); }
+        [[nodiscard]] bool hasGPU(const int idx) const { return gpuBits.contains(idx); }
+        [[nodiscard]] bool anyGPU(PWTS::Feature feature) const;
+        [[nodiscard]] bool hasFans() const { return fans; }
+
+        template<size_t N>
+        [[nodiscard]] bool anyCPU(const std::array<PWTS::Feature, N> &group) const {
+            for (const PWTS::Feature feature: group) {
+                if (cpu(feature))
+                    return true;
+            }
+
+            return false;
+        }
+    };
+}
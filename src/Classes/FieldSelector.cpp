@@ -0,0 +1,177 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <QJsonArray>
+
+#include "FieldSelector.h"
+
+namespace PWT::CLI {
+    bool FieldSelector::Node::matches(const QString &key) const {
+        if (!wildcard)
+            return key == pattern;
+
+        return key.size() >= (prefix.size() + suffix.size()) && key.startsWith(prefix) && key.endsWith(suffix);
+    }
+
+    bool FieldSelector::parse(const QString &paths) {
+        const QList<QString> pathList = paths.split(',', Qt::SkipEmptyParts);
+        const QSharedPointer<Node> tree = QSharedPointer<Node>::create();
+
+        if (pathList.isEmpty())
+            return false;
+
+        for (const QString &path: pathList) {
+            const QList<QString> segments = path.trimmed().split('.');
+            Node *node = tree.get();
+
+            for (const QString &segment: segments) {
+                const qsizetype wildcardPos = segment.indexOf('*');
+                Node *child = nullptr;
+
+                if (segment.isEmpty() || segment.count('*') > 1)
+                    return false;
+
+                for (Node &n: node->children) {
+                    if (n.pattern == segment) {
+                        child = &n;
+                        break;
+                    }
+                }
+
+                if (child == nullptr) {
+                    Node n;
+
+                    n.pattern = segment;
+                    n.wildcard = wildcardPos != -1;
+
+                    if (n.wildcard) {
+                        n.prefix = segment.first(wildcardPos);
+                        n.suffix = segment.sliced(wildcardPos + 1);
+                    }
+
+                    node->children.append(n);
+                    child = &node->children.last();
+                }
+
+                node = child;
+            }
+
+            node->terminal = true;
+        }
+
+        root = tree;
+        nodes = {root.get()};
+        return true;
+    }
+
+    bool FieldSelector::isAll() const {
+        if (root.isNull())
+            return true;
+
+        for (const Node *node: nodes) {
+            if (node->terminal)
+                return true;
+        }
+
+        return false;
+    }
+
+    bool FieldSelector::wants(const QString &key) const {
+        if (isAll())
+            return true;
+
+        for (const Node *node: nodes) {
+            for (const Node &child: node->children) {
+                if (child.matches(key))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    FieldSelector FieldSelector::select(const QString &key) const {
+        if (isAll())
+            return {};
+
+        FieldSelector sub;
+
+        sub.root = root;
+
+        for (const Node *node: nodes) {
+            for (const Node &child: node->children) {
+                if (child.matches(key))
+                    sub.nodes.append(&child);
+            }
+        }
+
+        return sub;
+    }
+
+    QJsonValue FieldSelector::projectValue(const QJsonValue &value) const {
+        if (isAll())
+            return value;
+
+        if (value.isObject()) {
+            const QJsonObject obj = project(value.toObject());
+
+            return obj.isEmpty() ? QJsonValue(QJsonValue::Undefined) : QJsonValue(obj);
+
+        } else if (value.isArray()) {
+            const QJsonArray arr = value.toArray();
+            QJsonArray projected;
+            bool hasValues = false;
+
+            // array elements are addressed by index, unselected ones become null to keep positions
+            for (qsizetype i=0,l=arr.size(); i<l; ++i) {
+                const QString idx = QString::number(i);
+                const QJsonValue val = wants(idx) ? select(idx).projectValue(arr[i]) : QJsonValue(QJsonValue::Undefined);
+
+                if (val.isUndefined()) {
+                    projected.append(QJsonValue::Null);
+                } else {
+                    projected.append(val);
+                    hasValues = true;
+                }
+            }
+
+            return hasValues ? QJsonValue(projected) : QJsonValue(QJsonValue::Undefined);
+        }
+
+        // selector goes deeper than a scalar
+        return QJsonValue::Undefined;
+    }
+
+    QJsonObject FieldSelector::project(const QJsonObject &obj) const {
+        if (isAll())
+            return obj;
+
+        QJsonObject projected;
+
+        for (auto it = obj.constBegin(); it != obj.constEnd(); ++it) {
+            if (!wants(it.key()))
+                continue;
+
+            const QJsonValue val = select(it.key()).projectValue(it.value());
+
+            if (!val.isUndefined())
+                projected.insert(it.key(), val);
+        }
+
+        return projected;
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QSharedPointer>
+#include <QJsonObject>
+
+namespace PWT::CLI {
+    class FieldSelector final {
+    private:
+        struct Node final {
+            QString pattern;
+            QString prefix;
+            QString suffix;
+            bool wildcard = false;
+            bool terminal = false;
+            QList<Node> children;
+
+            [[nodiscard]] bool matches(const QString &key) const;
+        };
+
+        // keeps the matcher tree alive, null when everything is selected
+        QSharedPointer<const Node> root;
+        // nodes matched by the path walked so far
+        QList<const Node *> nodes;
+
+        [[nodiscard]] QJsonValue projectValue(const QJsonValue &value) const;
+
+    public:
+        [[nodiscard]] bool parse(const QString &paths);
+        [[nodiscard]] bool isAll() const;
+        [[nodiscard]] bool wants(const QString &key) const;
+        [[nodiscard]] FieldSelector select(const QString &key) const;
+        [[nodiscard]] QJsonObject project(const QJsonObject &obj) const;
+    };
+}
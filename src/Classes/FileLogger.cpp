@@ -15,7 +15,6 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
-#include <QDateTime>
 #include <QFileInfo>
 
 #include "FileLogger.h"
@@ -45,17 +44,31 @@ namespace PWT::CLI {
     }
 
     void FileLogger::write(const QString &msg, const std::source_location source) {
+        const LogEntry entry {QDateTime::currentDateTime(), msg, source};
+
+        if (capture != nullptr)
+            capture->append(entry);
+        else
+            writeEntry(entry);
+    }
+
+    void FileLogger::write(const QList<LogEntry> &entries) {
+        for (const LogEntry &entry: entries)
+            writeEntry(entry);
+    }
+
+    void FileLogger::writeEntry(const LogEntry &entry) {
         if (!logFile.isOpen())
             return;
 
         if (logFile.size() >= limit)
             logFile.resize(0);
 
-        const QFileInfo srcFInfo {source.file_name()};
+        const QFileInfo srcFInfo {entry.source.file_name()};
 
-        ts << QDateTime::currentDateTime().toString("[ddd MMMM d yyyy hh:mm:ss]") << "\n" <<
-            srcFInfo.fileName() << "[" << source.line() << ":" << source.column() << "]: " << source.function_name() << "\n" <<
-            msg << "\n\n";
+        ts << entry.time.toString("[ddd MMMM d yyyy hh:mm:ss]") << "\n" <<
+            srcFInfo.fileName() << "[" << entry.source.line() << ":" << entry.source.column() << "]: " << entry.source.function_name() << "\n" <<
+            entry.msg << "\n\n";
 
         ts.flush();
 
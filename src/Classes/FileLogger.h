@@ -19,19 +19,29 @@
 
 #include <QSharedPointer>
 #include <QTextStream>
+#include <QDateTime>
 #include <QFile>
 #include <source_location>
 
 namespace PWT::CLI {
+    struct LogEntry final {
+        QDateTime time;
+        QString msg;
+        std::source_location source;
+    };
+
     class FileLogger final {
     private:
         static inline QSharedPointer<FileLogger> instance;
+        static inline thread_local QList<LogEntry> *capture = nullptr;
         static constexpr qint64 limit = 50 * 1000 * 1000;
         QTextStream ts;
         QFile logFile;
 
         FileLogger() = default;
 
+        void writeEntry(const LogEntry &entry);
+
     public:
         FileLogger(const FileLogger &) = delete;
         FileLogger &operator=(const FileLogger &) = delete;
@@ -41,5 +51,10 @@ namespace PWT::CLI {
         [[nodiscard]] static QSharedPointer<FileLogger> getInstance();
         void init(const QString &logPath);
         void write(const QString &msg, std::source_location source = std::source_location::current());
+        void write(const QList<LogEntry> &entries);
+
+        // messages written by the calling thread are stored in entries until endCapture
+        static void beginCapture(QList<LogEntry> *entries) { capture = entries; }
+        static void endCapture() { capture = nullptr; }
     };
 }
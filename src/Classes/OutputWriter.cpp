@@ -0,0 +1,226 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <QSaveFile>
+#include <QFile>
+#include <array>
+#ifdef WITH_GZIP
+#include <zlib.h>
+#endif
+#ifdef WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#include "OutputWriter.h"
+#include "../Utils.h"
+
+namespace PWT::CLI {
+    class OutputCompressor {
+    protected:
+        std::array<char, 64 * 1024> buffer {};
+
+    public:
+        virtual ~OutputCompressor() = default;
+
+        // append compressed data to out, finish also writes the end of the stream
+        [[nodiscard]] virtual bool compress(const char *data, qint64 len, bool finish, QByteArray &out) = 0;
+    };
+
+#ifdef WITH_GZIP
+    class GZipCompressor final: public OutputCompressor {
+    private:
+        z_stream zs {};
+        bool ready = false;
+
+    public:
+        GZipCompressor() {
+            // +16: write gzip header and trailer
+            ready = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+        }
+
+        ~GZipCompressor() override {
+            if (ready)
+                deflateEnd(&zs);
+        }
+
+        bool compress(const char *data, const qint64 len, const bool finish, QByteArray &out) override {
+            if (!ready)
+                return false;
+
+            zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+            zs.avail_in = static_cast<uInt>(len);
+
+            do {
+                zs.next_out = reinterpret_cast<Bytef *>(buffer.data());
+                zs.avail_out = static_cast<uInt>(buffer.size());
+
+                if (deflate(&zs, finish ? Z_FINISH : Z_NO_FLUSH) == Z_STREAM_ERROR)
+                    return false;
+
+                out.append(buffer.data(), static_cast<qsizetype>(buffer.size() - zs.avail_out));
+            } while (zs.avail_out == 0);
+
+            return true;
+        }
+    };
+#endif
+
+#ifdef WITH_ZSTD
+    class ZStdCompressor final: public OutputCompressor {
+    private:
+        ZSTD_CCtx *cctx = ZSTD_createCCtx();
+
+    public:
+        ~ZStdCompressor() override {
+            ZSTD_freeCCtx(cctx);
+        }
+
+        bool compress(const char *data, const qint64 len, const bool finish, QByteArray &out) override {
+            if (cctx == nullptr)
+                return false;
+
+            ZSTD_inBuffer in {data, static_cast<size_t>(len), 0};
+            bool done;
+
+            do {
+                ZSTD_outBuffer outBuf {buffer.data(), buffer.size(), 0};
+                const size_t remaining = ZSTD_compressStream2(cctx, &outBuf, &in, finish ? ZSTD_e_end : ZSTD_e_continue);
+
+                if (ZSTD_isError(remaining))
+                    return false;
+
+                out.append(buffer.data(), static_cast<qsizetype>(outBuf.pos));
+                done = finish ? remaining == 0 : in.pos == in.size;
+            } while (!done);
+
+            return true;
+        }
+    };
+#endif
+
+    OutputWriter::OutputWriter() = default;
+
+    OutputWriter::~OutputWriter() {
+        close();
+    }
+
+    QSharedPointer<OutputWriter> OutputWriter::getInstance() {
+        if (instance.isNull())
+            instance.reset(new OutputWriter);
+
+        return instance;
+    }
+
+    bool OutputWriter::init(const QString &path, const OutputCompression compression) {
+        if (isOpen())
+            return true;
+
+        switch (compression) {
+#ifdef WITH_GZIP
+            case OutputCompression::GZip:
+                compressor.reset(new GZipCompressor);
+                break;
+#endif
+#ifdef WITH_ZSTD
+            case OutputCompression::ZStd:
+                compressor.reset(new ZStdCompressor);
+                break;
+#endif
+            case OutputCompression::None:
+                break;
+            default:
+                printError(QStringLiteral("output compression is not supported by this build"));
+                return false;
+        }
+
+        if (path.isEmpty()) {
+            QFile *out = new QFile;
+
+            target.reset(out);
+
+            if (!out->open(stdout, QIODevice::WriteOnly))
+                return false;
+
+        } else {
+            QSaveFile *out = new QSaveFile(path);
+
+            target.reset(out);
+
+            if (!out->open(QIODevice::WriteOnly)) {
+                printError(QString("failed to open output file %1: %2").arg(path, out->errorString()));
+                return false;
+            }
+        }
+
+        return open(QIODevice::WriteOnly);
+    }
+
+    qint64 OutputWriter::readData(char *, qint64) {
+        return -1;
+    }
+
+    qint64 OutputWriter::writeData(const char *data, const qint64 len) {
+        if (writeFailed)
+            return -1;
+
+        written |= len > 0;
+
+        if (compressor.isNull()) {
+            writeFailed = target->write(data, len) != len;
+
+        } else {
+            QByteArray out;
+
+            writeFailed = !compressor->compress(data, len, false, out) || target->write(out) != out.size();
+        }
+
+        return writeFailed ? -1 : len;
+    }
+
+    // failed commands may still write a complete result, keep it whatever the exit code
+    bool OutputWriter::finish() {
+        if (!isOpen())
+            return true;
+
+        QSaveFile *file = qobject_cast<QSaveFile *>(target.get());
+        bool ret = !writeFailed;
+
+        if (ret && !compressor.isNull()) {
+            QByteArray out;
+
+            ret = compressor->compress(nullptr, 0, true, out) && target->write(out) == out.size();
+        }
+
+        close();
+
+        if (file == nullptr) {
+            ret = target->flush() && ret;
+
+        } else if (ret && written) {
+            ret = file->commit();
+
+        } else {
+            // the destination is left untouched
+            file->cancelWriting();
+        }
+
+        if (!ret)
+            printError(QString("failed to write output: %1").arg(target->errorString()));
+
+        return ret;
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QSharedPointer>
+#include <QFileDevice>
+
+#include "../Include/OutputFormat.h"
+
+namespace PWT::CLI {
+    class OutputCompressor;
+
+    // commands output, stdout or an atomically replaced file, optionally compressed while writing
+    class OutputWriter final: public QIODevice {
+    private:
+        static inline QSharedPointer<OutputWriter> instance;
+        QScopedPointer<QFileDevice> target;
+        QScopedPointer<OutputCompressor> compressor;
+        bool writeFailed = false;
+        bool written = false;
+
+        OutputWriter();
+
+    protected:
+        qint64 readData(char *data, qint64 maxSize) override;
+        qint64 writeData(const char *data, qint64 len) override;
+
+    public:
+        OutputWriter(const OutputWriter &) = delete;
+        OutputWriter &operator=(const OutputWriter &) = delete;
+
+        ~OutputWriter() override;
+
+        [[nodiscard]] static QSharedPointer<OutputWriter> getInstance();
+        [[nodiscard]] bool init(const QString &path, OutputCompression compression);
+        [[nodiscard]] bool finish();
+    };
+}
@@ -0,0 +1,167 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+namespace PWT::CLI {
+    template<typename T = void>
+    class Task;
+
+    namespace TaskDetail {
+        // resumes the awaiting coroutine, or frees a started task
+        template<typename P>
+        struct FinalAwaiter final {
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+            void await_resume() const noexcept {}
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) const noexcept {
+                P &promise = handle.promise();
+
+                if (promise.continuation)
+                    return promise.continuation;
+
+                if (promise.detached)
+                    handle.destroy();
+
+                return std::noop_coroutine();
+            }
+        };
+
+        struct PromiseBase {
+            std::coroutine_handle<> continuation;
+            bool detached = false;
+
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+            void unhandled_exception() const noexcept { std::terminate(); }
+        };
+
+        template<typename T>
+        struct Promise final: PromiseBase {
+            std::optional<T> value;
+
+            [[nodiscard]] Task<T> get_return_object() noexcept;
+            [[nodiscard]] FinalAwaiter<Promise> final_suspend() const noexcept { return {}; }
+            void return_value(T val) { value.emplace(std::move(val)); }
+            [[nodiscard]] T result() { return std::move(*value); }
+        };
+
+        template<>
+        struct Promise<void> final: PromiseBase {
+            [[nodiscard]] Task<void> get_return_object() noexcept;
+            [[nodiscard]] FinalAwaiter<Promise> final_suspend() const noexcept { return {}; }
+            void return_void() const noexcept {}
+            void result() const noexcept {}
+        };
+    }
+
+    // lazy coroutine, runs when awaited or started.
+    // commands wait for daemon replies without a slot per reply, see AsyncService
+    template<typename T>
+    class [[nodiscard]] Task final {
+    public:
+        using promise_type = TaskDetail::Promise<T>;
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+
+    public:
+        explicit Task(const std::coroutine_handle<promise_type> h): handle(h) {}
+        Task(Task &&other) noexcept: handle(std::exchange(other.handle, {})) {}
+        Task(const Task &) = delete;
+        Task &operator=(const Task &) = delete;
+        Task &operator=(Task &&) = delete;
+
+        ~Task() {
+            if (handle)
+                handle.destroy();
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        [[nodiscard]] T await_resume() { return handle.promise().result(); }
+
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        // run without an awaiting coroutine, the frame is freed when the task completes
+        void start() && {
+            const std::coroutine_handle<promise_type> h = std::exchange(handle, {});
+
+            h.promise().detached = true;
+            h.resume();
+        }
+    };
+
+    template<typename T>
+    Task<T> TaskDetail::Promise<T>::get_return_object() noexcept {
+        return Task<T>(std::coroutine_handle<Promise>::from_promise(*this));
+    }
+
+    inline Task<void> TaskDetail::Promise<void>::get_return_object() noexcept {
+        return Task<void>(std::coroutine_handle<Promise>::from_promise(*this));
+    }
+
+    namespace TaskDetail {
+        struct WhenAllState final {
+            size_t pending;
+            std::coroutine_handle<> waiting;
+        };
+
+        // the waiting coroutine holds one count, it resumes when the last task completes
+        struct WhenAllAwaiter final {
+            WhenAllState &state;
+
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+            void await_resume() const noexcept {}
+
+            [[nodiscard]] bool await_suspend(const std::coroutine_handle<> handle) const noexcept {
+                state.waiting = handle;
+                return --state.pending != 0;
+            }
+        };
+
+        template<typename T>
+        Task<> complete(Task<T> task, std::optional<T> &result, WhenAllState &state) {
+            result.emplace(co_await task);
+
+            if (--state.pending == 0)
+                state.waiting.resume();
+        }
+    }
+
+    // run tasks side by side, for example one per daemon, and wait for all results
+    template<typename... T>
+    Task<std::tuple<T...>> whenAll(Task<T>... tasks) {
+        TaskDetail::WhenAllState state {sizeof...(T) + 1, {}};
+        std::tuple<std::optional<T>...> results;
+
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (TaskDetail::complete(std::move(tasks), std::get<I>(results), state).start(), ...);
+        }(std::index_sequence_for<T...>());
+
+        co_await TaskDetail::WhenAllAwaiter {state};
+
+        co_return std::apply([](std::optional<T> &...res) { return std::tuple<T...>(std::move(*res)...); }, results);
+    }
+}
@@ -17,28 +17,341 @@
  */
 #pragma once
 
+#include <QDataStream>
+#include <QSemaphore>
+#include <QThreadPool>
+#include <concepts>
+
+#include "SettingRegistry.h"
 #include "../CMDParser/CMDParser.h"
 #include "../Classes/FileLogger.h"
+#include "../Classes/FeatureSet.h"
 #include "pwtShared/Include/Features.h"
 
 namespace PWT::CLI {
+    struct ClampedValue final {
+        Setting setting;
+        QString index;
+        int requested;
+        int value;
+    };
+
+    struct InvalidValue final {
+        Setting setting;
+        QString value;
+    };
+
+    struct ClientPacketInfo final {
+        int changes = 0;
+        QList<ClampedValue> clamped;
+        QList<InvalidValue> invalid;
+        QList<Setting> collapsed;
+    };
+
     class CliHelper {
+    private:
+        // forEachIndex results of a chunk, merged in index order
+        struct ChunkResult final {
+            int changes = 0;
+            QList<ClampedValue> clamped;
+            QList<InvalidValue> invalid;
+            QList<LogEntry> log;
+        };
+
+        static inline thread_local ChunkResult *chunkResult = nullptr;
+
     protected:
+        // below this, the pool overhead is larger than the setters work
+        static constexpr int parallelMinCount = 64;
+        static constexpr int parallelChunkSize = 16;
+
         QSharedPointer<CMDParser> cmdParser;
         QSharedPointer<FileLogger> logger;
-        PWTS::Features features;
+        QSharedPointer<UI::InputRanges> inputRanges;
+        FeatureSet features;
+        bool diffApply;
+        mutable int changes = 0;
+        mutable QList<ClampedValue> clamped;
+        mutable QList<InvalidValue> invalid;
+        mutable QList<Setting> collapsed; // per-cpu settings sent as a single package request
+
+        void logInvalidValue(const Setting setting, const QString &val) const {
+            logger->write(QString("%1: invalid value: %2").arg(settingName(setting), val));
+            (chunkResult != nullptr ? chunkResult->invalid : invalid).append({setting, val});
+        }
+
+        // qBound, but values out of range are logged and reported
+        [[nodiscard]] int boundSetting(const Setting setting, const int min, const int value, const int max, const QString &argIdx = {}) const {
+            const int bounded = qBound(min, value, max);
+
+            if (bounded != value) {
+                const QString name = argIdx.isEmpty() ? settingName(setting) : QString("%1[%2]").arg(settingName(setting), argIdx);
+
+                logger->write(QString("%1: value %2 out of range, clamped to %3").arg(name).arg(value).arg(bounded));
+                (chunkResult != nullptr ? chunkResult->clamped : clamped).append({setting, argIdx, value, bounded});
+            }
+
+            return bounded;
+        }
+
+        [[nodiscard]] int boundSetting(const Setting setting, const int min, const int value, const int max, const int idx) const {
+            if (value >= min && value <= max)
+                return value;
+
+            return boundSetting(setting, min, value, max, QString::number(idx));
+        }
+
+        template<typename... I>
+        [[nodiscard]] int boundSetting(const Setting setting, const SettingRange &range, const int value, const I... idx) const {
+            if (range.source == SettingRange::Source::None)
+                return value;
+
+            const std::optional<SettingBounds> bounds = range.bounds(*inputRanges);
+
+            return boundSetting(setting, bounds->min, value, bounds->max, idx...);
+        }
+
+        // value of a registry setting converted to the packet data type T, read by the setting schema type
+        template<typename T, typename... I>
+        [[nodiscard]] std::optional<T> readSetting(const Setting setting, const SettingRange &range, const I... idx) const {
+            const SettingValue &value = cmdParser->getSetting(setting);
+            std::optional<int> val;
+
+            if (getSettingInfo(setting).type == SettingType::Bool) {
+                std::optional<bool> bval;
+
+                if constexpr (sizeof...(idx) == 0)
+                    bval = value.toBool();
+                else
+                    bval = value.boolAt(idx...);
+
+                if (!bval)
+                    return std::nullopt;
+
+                return static_cast<T>(*bval);
+            }
+
+            if constexpr (sizeof...(idx) == 0)
+                val = value.toInt();
+            else
+                val = value.intAt(idx...);
+
+            if (!val)
+                return std::nullopt;
+
+            return static_cast<T>(boundSetting(setting, range, *val, idx...));
+        }
+
+        // per-cpu values of an int setting, clamped in flat loops over thread view columns.
+        // cpus without a value keep the current one, out of range values of valid cpus are reported
+        [[nodiscard]] QList<int> boundColumn(const Setting setting, const QList<int> &current, const QList<bool> &valid,
+                                             const QList<int> &min, const QList<int> &max) const {
+            if (!cmdParser->hasSetting(setting))
+                return current;
+
+            const SettingValue &value = cmdParser->getSetting(setting);
+            const int count = static_cast<int>(current.size());
+            QList<int> requested = current;
+            QList<int> bounded(count);
+            QList<bool> given(count);
+            int *req = requested.data();
+            int *bnd = bounded.data();
+            bool *hasValue = given.data();
+            const int *minData = min.constData();
+            const int *maxData = max.constData();
+
+            for (int i=0; i<count; ++i) {
+                if (const std::optional<int> val = value.intAt(i)) {
+                    req[i] = *val;
+                    hasValue[i] = true;
+                }
+            }
+
+            for (int i=0; i<count; ++i)
+                bnd[i] = hasValue[i] ? qBound(minData[i], req[i], maxData[i]) : req[i];
+
+            for (int i=0; i<count; ++i) {
+                if (valid[i] && bnd[i] != req[i])
+                    bnd[i] = boundSetting(setting, minData[i], req[i], maxData[i], i);
+            }
+
+            return bounded;
+        }
+
+        template<typename... I>
+        void logInvalidPacketData(const I... idx) const {
+            if constexpr (sizeof...(idx) == 0)
+                logger->write(QStringLiteral("invalid data in packet"));
+            else
+                logger->write(QString("invalid data in packet for cpu %1").arg(idx...));
+        }
+
+        // values are compared as their type, shared structs without operator== by the bytes the daemon receives
+        template<typename T>
+        [[nodiscard]] static bool isSameValue(const T &a, const T &b) {
+            if constexpr (std::equality_comparable<T>) {
+                return a == b;
+
+            } else {
+                QByteArray aData, bData;
+                QDataStream aDs(&aData, QIODevice::WriteOnly);
+                QDataStream bDs(&bData, QIODevice::WriteOnly);
 
-        void logInvalidValue(const QString &arg, const QString &val) const { logger->write(QString("%1: invalid value: %2").arg(arg, val)); }
+                aDs << a;
+                bDs << b;
+
+                return aData == bData;
+            }
+        }
+
+        // in diff mode, data is not applied by the daemon unless setData changes it
+        template<typename... D>
+        void skipData(D &...data) const {
+            if (diffApply)
+                (data.setIgnored(true), ...);
+        }
+
+        template<typename T, template<typename> typename D>
+        void setData(D<T> &data, const std::type_identity_t<T> &value) const {
+            if (diffApply && isSameValue(data.getValue(), value))
+                return;
+
+            data.setValue(value, true);
+            data.setIgnored(false);
+            ++(chunkResult != nullptr ? chunkResult->changes : changes);
+        }
+
+        // registry engine, idx is the cpu index of core and thread data
+
+        template<typename D, typename F, typename... I>
+        void setField(D &data, const FieldSetting<D, F> &desc, const I... idx) const {
+            if (!features.cpu(desc.feature))
+                return;
+
+            F &field = data.*desc.field;
+
+            if (!cmdParser->hasSetting(desc.setting)) {
+                if (desc.unset == UnsetData::Ignore || (desc.unset == UnsetData::IgnoreUnreadable && !features.cpu(desc.readFeature)))
+                    field.setIgnored(true);
+
+                return;
+            }
+
+            if (!field.isValid()) {
+                logInvalidPacketData(idx...);
+                return;
+            }
+
+            using T = std::remove_cvref_t<decltype(field.getValue())>;
+            const std::optional<T> value = readSetting<T>(desc.setting, desc.range, idx...);
+
+            if (value)
+                setData(field, *value);
+        }
+
+        template<typename V, typename M, typename... I>
+        void setMember(V &value, const MemberSetting<V, M> &desc, const I... idx) const {
+            if (!cmdParser->hasSetting(desc.setting) || (desc.feature && !features.cpu(*desc.feature)))
+                return;
+
+            const std::optional<M> val = readSetting<M>(desc.setting, desc.range, idx...);
+
+            if (val)
+                value.*desc.member = *val;
+        }
+
+        template<typename T>
+        [[nodiscard]] bool hasAnySetting(const T &members) const {
+            return std::apply([this](const auto &...desc) { return (cmdParser->hasSetting(desc.setting) || ...); }, members);
+        }
+
+        template<typename V, typename T, typename... I>
+        void setMembers(V &value, const T &members, const I... idx) const {
+            std::apply([&](const auto &...desc) { (setMember(value, desc, idx...), ...); }, members);
+        }
+
+        template<typename D, typename F, typename T, typename... I>
+        void setField(D &data, const RegisterSetting<D, F, T> &desc, const I... idx) const {
+            if (!features.cpu(desc.feature) || !hasAnySetting(desc.members))
+                return;
+
+            F &field = data.*desc.field;
+
+            if (!field.isValid()) {
+                logInvalidPacketData(idx...);
+                return;
+            }
+
+            auto value = field.getValue();
+
+            setMembers(value, desc.members, idx...);
+            setData(field, value);
+        }
+
+        // applies a tuple of FieldSetting and RegisterSetting, in order
+        template<typename D, typename T, typename... I>
+        void setFields(D &data, const T &registry, const I... idx) const {
+            std::apply([&](const auto &...desc) { (setField(data, desc, idx...), ...); }, registry);
+        }
+
+        // fn(i) for indexes [0, count), large counts run in fixed size chunks on a thread pool,
+        // fn must only write the data of its index.
+        // output is the same as the serial loop, chunks results are merged in index order
+        template<typename F>
+        void forEachIndex(const int count, F &&fn) const {
+            if (count < parallelMinCount) {
+                for (int i=0; i<count; ++i)
+                    fn(i);
+
+                return;
+            }
+
+            QList<ChunkResult> results((count + parallelChunkSize - 1) / parallelChunkSize);
+            ChunkResult *resultsData = results.data();
+            QSemaphore done;
+
+            // idle workers take the next chunk from the pool queue
+            for (int c=0,l=results.size(); c<l; ++c) {
+                QThreadPool::globalInstance()->start([&fn, &done, resultsData, count, c] {
+                    chunkResult = &resultsData[c];
+                    FileLogger::beginCapture(&chunkResult->log);
+
+                    for (int i=c*parallelChunkSize,last=std::min(count, i + parallelChunkSize); i<last; ++i)
+                        fn(i);
+
+                    FileLogger::endCapture();
+                    chunkResult = nullptr;
+                    done.release();
+                });
+            }
+
+            done.acquire(results.size());
+
+            for (const ChunkResult &result: std::as_const(results)) {
+                changes += result.changes;
+                clamped.append(result.clamped);
+                invalid.append(result.invalid);
+                logger->write(result.log);
+            }
+        }
 
     public:
-        CliHelper(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures) {
+        CliHelper(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures) {
             cmdParser = cmd;
             features = daemonFeatures;
             logger = FileLogger::getInstance();
+            diffApply = !cmdParser->isSet(CMDArg::SET_FORCE_APPLY) && !cmdParser->isSet(CMDArg::SET_MAKE_PROFILE);
         }
 
         virtual ~CliHelper() = default;
 
         virtual void setClientPacketData() = 0;
+
+        void addPacketInfo(ClientPacketInfo &info) const {
+            info.changes += changes;
+            info.clamped.append(clamped);
+            info.invalid.append(invalid);
+            info.collapsed.append(collapsed);
+        }
     };
 }
@@ -16,45 +16,38 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "CliHelperFan.h"
-#include "../../CMDParser/SettingsArguments.h"
 
 namespace PWT::CLI {
-    CliHelperFan::CliHelperFan(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures, const QMap<QString, PWTS::FanData> &data): CliHelper(cmd, daemonFeatures) {
-        packetData = data;
-    }
-
-    QMap<QString, PWTS::FanData> CliHelperFan::getData() const {
-        return packetData;
-    }
+    CliHelperFan::CliHelperFan(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures, QMap<QString, PWTS::FanData> &data,
+                                const QMap<QString, PWTS::FanData> &daemonFanData): CliHelper(cmd, daemonFeatures), packetData(data), daemonData(daemonFanData) {}
 
     void CliHelperFan::setFanMode() {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, fanModeArg))
+        if (!cmdParser->hasSetting(Setting::FanMode))
             return;
 
-        const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, fanModeArg).toHash();
+        const QHash<QString, SettingValue::Value> &args = cmdParser->getSetting(Setting::FanMode).entries();
 
         for (const auto &[id, mode]: args.asKeyValueRange()) {
-            const int modeI = mode.toInt();
+            const int modeI = std::get<int>(mode);
 
             if (!packetData.contains(id)) {
                 logger->write(QString("invalid fan id: %1").arg(id));
                 continue;
 
             } else if (modeI < 0 || modeI > 1) {
-                logInvalidValue(fanModeArg, QString::number(modeI));
+                logInvalidValue(Setting::FanMode, QString::number(modeI));
                 continue;
             }
 
-            packetData[id].mode.setValue(modeI, true);
+            setData(packetData[id].mode, modeI);
         }
     }
 
     void CliHelperFan::setFanCurve() {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, fanTripPointArg))
+        if (!cmdParser->hasSetting(Setting::FanTripPoint))
             return;
 
-        const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, fanTripPointArg).toHash();
-        const QMap<QString, PWTS::FanData> oldMap = packetData;
+        const QHash<QString, SettingValue::Value> &args = cmdParser->getSetting(Setting::FanTripPoint).entries();
 
         // clear current curves so that we can set parsed data
         for (PWTS::FanData &data: packetData)
@@ -77,7 +70,7 @@ namespace PWT::CLI {
                     continue;
                 }
 
-                packetData[fanID].curve.append(std::make_pair(data[1].toInt(), qBound(0, speed.toInt(), 100)));
+                packetData[fanID].curve.append(std::make_pair(data[1].toInt(), boundSetting(Setting::FanTripPoint, 0, std::get<int>(speed), 100, curveData)));
 
             } else { // fixed speed, curvedata is the fan id
                 if (!packetData.contains(curveData)) {
@@ -85,24 +78,44 @@ namespace PWT::CLI {
                     continue;
                 }
 
-                packetData[curveData].curve.append(std::make_pair(0, qBound(0, speed.toInt(), 100)));
+                packetData[curveData].curve.append(std::make_pair(0, boundSetting(Setting::FanTripPoint, 0, std::get<int>(speed), 100, curveData)));
             }
         }
 
         // add back untouched curves
-        for (const auto &[fanID, data]: oldMap.asKeyValueRange()) {
-            if (!packetData[fanID].curve.isEmpty()) // modified curve, do not restore old data
+        for (const auto &[fanID, data]: daemonData.asKeyValueRange()) {
+            if (!packetData[fanID].curve.isEmpty()) { // modified curve, do not restore old data
+                if (packetData[fanID].curve != data.curve)
+                    ++changes;
+
                 continue;
+            }
 
             packetData[fanID].curve = data.curve;
         }
     }
 
     void CliHelperFan::setClientPacketData() {
-        if (features.fans.isEmpty())
+        if (!features.hasFans())
             return;
 
+        for (PWTS::FanData &data: packetData)
+            skipData(data.mode);
+
         setFanMode();
         setFanCurve();
+
+        if (!diffApply)
+            return;
+
+        // send only fans with a new mode or curve
+        for (auto it = packetData.begin(); it != packetData.end();) {
+            const auto old = daemonData.constFind(it.key());
+
+            if (old != daemonData.constEnd() && it->mode.getValue() == old->mode.getValue() && it->curve == old->curve)
+                it = packetData.erase(it);
+            else
+                ++it;
+        }
     }
 }
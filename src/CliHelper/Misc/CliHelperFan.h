@@ -23,15 +23,16 @@
 namespace PWT::CLI {
     class CliHelperFan final: public CliHelper {
     private:
-        QMap<QString, PWTS::FanData> packetData;
+        QMap<QString, PWTS::FanData> &packetData;
+        const QMap<QString, PWTS::FanData> &daemonData;
 
         void setFanMode();
         void setFanCurve();
 
     public:
-        CliHelperFan(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures, const QMap<QString, PWTS::FanData> &data);
+        // data is updated in place, daemonData is the unchanged daemon packet data
+        CliHelperFan(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures, QMap<QString, PWTS::FanData> &data, const QMap<QString, PWTS::FanData> &daemonFanData);
 
         void setClientPacketData() override;
-        [[nodiscard]] QMap<QString, PWTS::FanData> getData() const;
     };
 }
@@ -16,42 +16,72 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "CliHelperLinux.h"
-#include "../../../CMDParser/SettingsArguments.h"
 
 namespace PWT::CLI {
-    CliHelperLinux::CliHelperLinux(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures, const QSharedPointer<PWTS::LNX::LinuxData> &data): CliHelper(cmd, daemonFeatures) {
+    CliHelperLinux::CliHelperLinux(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures, const QSharedPointer<PWTS::LNX::LinuxData> &data): CliHelper(cmd, daemonFeatures) {
         packetData = data;
     }
 
     void CliHelperLinux::setBlockQueueSchedulers() const {
-        const QHash<QString, QVariant> devMap = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, blockDevQueSchedArg).toHash();
+        const QHash<QString, SettingValue::Value> &devMap = cmdParser->getSetting(Setting::BlockDevQueSched).entries();
+        QSet<QString> changed;
 
         for (const auto &[device, scheduler]: devMap.asKeyValueRange()) {
             if (!packetData->blockDevicesQueSched.contains(device))
                 continue;
 
-            const QString sched = scheduler.toString();
+            const QString sched = std::get<QString>(scheduler);
 
             if (!packetData->blockDevicesQueSched[device].availableQueueSchedulers.contains(sched)) {
                 logger->write(QString("invalid scheduler '%1' for device '%2'").arg(sched, device));
                 continue;
+
+            } else if (diffApply && packetData->blockDevicesQueSched[device].scheduler == sched) {
+                continue;
             }
 
             packetData->blockDevicesQueSched[device].scheduler = sched;
+            changed.insert(device);
+            ++changes;
 
             // delete ro data
             packetData->blockDevicesQueSched[device].availableQueueSchedulers.clear();
             packetData->blockDevicesQueSched[device].name.clear();
         }
+
+        if (!diffApply)
+            return;
+
+        // send only devices with a new scheduler
+        for (auto it = packetData->blockDevicesQueSched.begin(); it != packetData->blockDevicesQueSched.end();) {
+            if (changed.contains(it.key()))
+                ++it;
+            else
+                it = packetData->blockDevicesQueSched.erase(it);
+        }
     }
 
     void CliHelperLinux::setMiscPmDevs() const {
-        const QHash<QString, QVariant> devMap = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, miscPmDevsArg).toHash();
+        const QHash<QString, SettingValue::Value> &devMap = cmdParser->getSetting(Setting::MiscPmDevs).entries();
+        QSet<QString> changed;
 
         for (PWTS::LNX::MiscPMDevice &dev: packetData->miscPMDevices) {
-            if (devMap.contains(dev.control))
-                dev.controlValue = devMap[dev.control].toString();
+            if (!devMap.contains(dev.control))
+                continue;
+
+            const QString value = std::get<QString>(devMap[dev.control]);
+
+            if (dev.controlValue == value)
+                continue;
+
+            dev.controlValue = value;
+            changed.insert(dev.control);
+            ++changes;
         }
+
+        // send only devices with a new control value
+        if (diffApply)
+            packetData->miscPMDevices.removeIf([&changed](const PWTS::LNX::MiscPMDevice &dev) { return !changed.contains(dev.control); });
     }
 
     void CliHelperLinux::setSMTState() const {
@@ -60,13 +90,13 @@ namespace PWT::CLI {
             return;
         }
 
-        const QString smt = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, smtStateArg).toString();
+        const QString smt = cmdParser->getSetting(Setting::SmtState).toString();
         const QList<QString> validList = {"on", "off", "forceoff"};
 
         if (validList.contains(smt))
-            packetData->smtState.setValue(smt, true);
+            setData(packetData->smtState, smt);
         else
-            logInvalidValue(smtStateArg, smt);
+            logInvalidValue(Setting::SmtState, smt);
     }
 
     void CliHelperLinux::setCPUIdleGovernor() const {
@@ -75,27 +105,27 @@ namespace PWT::CLI {
             return;
         }
 
-        const QString gov = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuIdleGovernorArg).toString();
+        const QString gov = cmdParser->getSetting(Setting::CpuIdleGovernor).toString();
         const QList<QString> validList = packetData->cpuIdleAvailableGovernors.getValue();
 
         if (validList.contains(gov))
-            packetData->cpuIdleGovernor.setValue(gov, true);
+            setData(packetData->cpuIdleGovernor, gov);
         else
-            logInvalidValue(cpuIdleGovernorArg, gov);
+            logInvalidValue(Setting::CpuIdleGovernor, gov);
 
         // delete ro data
         packetData->cpuIdleAvailableGovernors = {};
     }
 
-    void CliHelperLinux::setIntelGPURpsFreq(PWTS::LNX::LinuxIntelGPUData &data, const QString &argIdx) const {
-        const bool hasRpsMin = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, gpuRpsMinFreqArg);
-        const bool hasRpsMax = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, gpuRpsMaxFreqArg);
+    void CliHelperLinux::setIntelGPURpsFreq(PWTS::LNX::LinuxIntelGPUData &data, const int idx) const {
+        const bool hasRpsMin = cmdParser->hasSetting(Setting::GpuRpsMinFreq);
+        const bool hasRpsMax = cmdParser->hasSetting(Setting::GpuRpsMaxFreq);
 
         if (!hasRpsMin && !hasRpsMax)
             return;
 
         if (!data.rpsLimits.isValid() || !data.frequency.isValid()) {
-            logger->write(QString("invalid data in packet for gpu %1").arg(argIdx));
+            logger->write(QString("invalid data in packet for gpu %1").arg(idx));
             return;
         }
 
@@ -103,90 +133,82 @@ namespace PWT::CLI {
         PWTS::MinMax freq = data.frequency.getValue();
 
         if (hasRpsMin) {
-            const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, gpuRpsMinFreqArg).toHash();
+            const std::optional<int> value = cmdParser->getSetting(Setting::GpuRpsMinFreq).intAt(idx);
 
-            if (argData.contains("all"))
-                freq.min = argData["all"].toInt();
-            else if (argData.contains(argIdx))
-                freq.min = argData[argIdx].toInt();
+            if (value)
+                freq.min = *value;
         }
 
         if (hasRpsMax) {
-            const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, gpuRpsMaxFreqArg).toHash();
+            const std::optional<int> value = cmdParser->getSetting(Setting::GpuRpsMaxFreq).intAt(idx);
 
-            if (argData.contains("all"))
-                freq.max = argData["all"].toInt();
-            else if (argData.contains(argIdx))
-                freq.max = argData[argIdx].toInt();
+            if (value)
+                freq.max = *value;
         }
 
-        data.frequency.setValue({
-            qBound(limits.rpn, freq.min, limits.rp0),
-            qBound(limits.rpn, freq.max, limits.rp0)
-        }, true);
+        setData(data.frequency, {
+            boundSetting(Setting::GpuRpsMinFreq, limits.rpn, freq.min, limits.rp0, idx),
+            boundSetting(Setting::GpuRpsMaxFreq, limits.rpn, freq.max, limits.rp0, idx)
+        });
     }
 
-    void CliHelperLinux::setIntelGPURpsMaxBoostFreq(PWTS::LNX::LinuxIntelGPUData &data, const QString &argIdx) const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, gpuRpsMaxBoostArg))
+    void CliHelperLinux::setIntelGPURpsMaxBoostFreq(PWTS::LNX::LinuxIntelGPUData &data, const int idx) const {
+        if (!cmdParser->hasSetting(Setting::GpuRpsMaxBoost))
             return;
 
         if (!data.rpsLimits.isValid() || !data.boostFrequency.isValid()) {
-            logger->write(QString("invalid data in packet for gpu %1").arg(argIdx));
+            logger->write(QString("invalid data in packet for gpu %1").arg(idx));
             return;
         }
 
-        const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, gpuRpsMaxBoostArg).toHash();
+        const std::optional<int> value = cmdParser->getSetting(Setting::GpuRpsMaxBoost).intAt(idx);
         const PWTS::LNX::Intel::GPURPSLimits limits = data.rpsLimits.getValue();
         int boost;
 
-        if (argData.contains("all"))
-            boost = argData["all"].toInt();
-        else if (argData.contains(argIdx))
-            boost = argData[argIdx].toInt();
+        if (value)
+            boost = *value;
         else
             return;
 
-        data.boostFrequency.setValue(qBound(limits.rpn, boost, limits.rp0), true);
+        setData(data.boostFrequency, boundSetting(Setting::GpuRpsMaxBoost, limits.rpn, boost, limits.rp0, idx));
     }
 
-    void CliHelperLinux::setAMDGPUPowerDPMState(PWTS::LNX::LinuxAMDGPUData &data, const QString &argIdx) const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmStateArg))
+    void CliHelperLinux::setAMDGPUPowerDPMState(PWTS::LNX::LinuxAMDGPUData &data, const int idx) const {
+        if (!cmdParser->hasSetting(Setting::PowerDpmState))
             return;
 
         if (!data.powerDpmState.isValid()) {
-            logger->write(QString("invalid data in packet for gpu %1").arg(argIdx));
+            logger->write(QString("invalid data in packet for gpu %1").arg(idx));
             return;
         }
 
-        const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmStateArg).toHash();
+        const std::optional<QString> value = cmdParser->getSetting(Setting::PowerDpmState).stringAt(idx);
         const QList<QString> validList = {"battery", "balanced", "performance"};
         QString state;
 
-        if (argData.contains("all"))
-            state = argData["all"].toString();
-        else if (argData.contains(powerDpmStateArg))
-            state = argData[argIdx].toString();
+        if (value)
+            state = *value;
         else
             return;
 
         if (validList.contains(state))
-            data.powerDpmState.setValue(state, true);
+            setData(data.powerDpmState, state);
         else
-           logInvalidValue(powerDpmStateArg, state);
+           logInvalidValue(Setting::PowerDpmState, state);
     }
 
-    void CliHelperLinux::setAMDGPUPowerDPMForcePerfLevel(PWTS::LNX::LinuxAMDGPUData &data, const QString &argIdx) const {
-        const bool hasDpmPerfLvlLvl = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmForcePerfLvlArg);
-        const bool hasDpmPerfLvlSclkMin = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmForcePerfMinSclkArg);
-        const bool hasDpmPerfLvlSclkMax = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmForcePerfMaxSclkArg);
-        const bool hasDpmPerfLvlReset = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmForcePerfResetArg);
+    void CliHelperLinux::setAMDGPUPowerDPMForcePerfLevel(PWTS::LNX::LinuxAMDGPUData &data, const int idx) const {
+        const bool hasDpmPerfLvlLvl = cmdParser->hasSetting(Setting::PowerDpmForcePerfLvl);
+        const bool hasDpmPerfLvlSclkMin = cmdParser->hasSetting(Setting::PowerDpmForcePerfMinSclk);
+        const bool hasDpmPerfLvlSclkMax = cmdParser->hasSetting(Setting::PowerDpmForcePerfMaxSclk);
+        const bool hasDpmPerfLvlReset = cmdParser->hasSetting(Setting::PowerDpmForcePerfReset);
         const bool hasArgs = hasDpmPerfLvlLvl || hasDpmPerfLvlSclkMin || hasDpmPerfLvlSclkMax || hasDpmPerfLvlReset;
 
         if (!hasArgs)
             return;
 
         if (!data.odRanges.isValid() || !data.dpmForcePerfLevel.isValid()) {
-            logger->write(QString("invalid data in packet for gpu %1").arg(argIdx));
+            logger->write(QString("invalid data in packet for gpu %1").arg(idx));
             return;
         }
 
@@ -194,207 +216,207 @@ namespace PWT::CLI {
         PWTS::LNX::AMD::GPUDPMForcePerfLevel dpmData = data.dpmForcePerfLevel.getValue();
 
         if (hasDpmPerfLvlLvl) {
-            const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmForcePerfLvlArg).toHash();
+            const std::optional<QString> value = cmdParser->getSetting(Setting::PowerDpmForcePerfLvl).stringAt(idx);
             const QList<QString> validList = {"auto", "low", "high", "manual", "profile_standard", "profile_min_sclk", "profile_min_mclk", "profile_peak"};
             QString lvl;
 
-            if (argData.contains("all"))
-                lvl = argData["all"].toString();
-            else if (argData.contains(argIdx))
-                lvl = argData[argIdx].toString();
+            if (value)
+                lvl = *value;
 
             if (!lvl.isEmpty()) {
                 if (validList.contains(lvl))
                     dpmData.level = lvl;
                 else
-                    logInvalidValue(powerDpmForcePerfLvlArg, lvl);
+                    logInvalidValue(Setting::PowerDpmForcePerfLvl, lvl);
             }
         }
 
         if (hasDpmPerfLvlSclkMin) {
-            const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmForcePerfMinSclkArg).toHash();
+            const std::optional<int> value = cmdParser->getSetting(Setting::PowerDpmForcePerfMinSclk).intAt(idx);
             int min = -1;
 
-            if (argData.contains("all"))
-                min = argData["all"].toInt();
-            else if (argData.contains(argIdx))
-                min = argData[argIdx].toInt();
+            if (value)
+                min = *value;
 
             if (min != -1)
-                dpmData.sclk.min = qBound(limits.sclk.min, min, limits.sclk.max);
+                dpmData.sclk.min = boundSetting(Setting::PowerDpmForcePerfMinSclk, limits.sclk.min, min, limits.sclk.max, idx);
         }
 
         if (hasDpmPerfLvlSclkMax) {
-            const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmForcePerfMaxSclkArg).toHash();
+            const std::optional<int> value = cmdParser->getSetting(Setting::PowerDpmForcePerfMaxSclk).intAt(idx);
             int max = -1;
 
-            if (argData.contains("all"))
-                max = argData["all"].toInt();
-            else if (argData.contains(argIdx))
-                max = argData[argIdx].toInt();
+            if (value)
+                max = *value;
 
             if (max != -1)
-                dpmData.sclk.max = qBound(limits.sclk.min, max, limits.sclk.max);
+                dpmData.sclk.max = boundSetting(Setting::PowerDpmForcePerfMaxSclk, limits.sclk.min, max, limits.sclk.max, idx);
         }
 
         if (hasDpmPerfLvlReset) {
-            const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerDpmForcePerfResetArg).toHash();
+            const std::optional<bool> value = cmdParser->getSetting(Setting::PowerDpmForcePerfReset).boolAt(idx);
 
-            if (argData.contains("all"))
-                dpmData.reset = argData["all"].toBool();
-            else if (argData.contains(argIdx))
-                dpmData.reset =argData[argIdx].toBool();
+            if (value)
+                dpmData.reset = *value;
         }
 
-        data.dpmForcePerfLevel.setValue(dpmData, true);
+        setData(data.dpmForcePerfLevel, dpmData);
     }
 
-    void CliHelperLinux::setCPUOfflineStatus(PWTS::LNX::LinuxThreadData &data, const QString &argIdx) const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuStatusArg))
+    void CliHelperLinux::setCPUOfflineStatus(PWTS::LNX::LinuxThreadData &data, const int idx) const {
+        if (!cmdParser->hasSetting(Setting::CpuStatus))
             return;
 
         if (!data.cpuOnlineStatus.isValid() || !data.cpuLogicalOffAvailable.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
+            logger->write(QString("invalid data in packet for cpu %1").arg(idx));
             return;
 
         } else if (!data.cpuLogicalOffAvailable.getValue()) {
             return;
         }
 
-        const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuStatusArg).toHash();
+        const std::optional<bool> value = cmdParser->getSetting(Setting::CpuStatus).boolAt(idx);
         int status;
 
-        if (argData.contains("all"))
-            status = argData["all"].toBool();
-        else if (argData.contains(argIdx))
-            status = argData[argIdx].toBool();
+        if (value)
+            status = *value;
         else
             return;
 
-        data.cpuOnlineStatus.setValue(status, true);
+        setData(data.cpuOnlineStatus, status);
     }
 
-    void CliHelperLinux::setCPUFreq(PWTS::LNX::LinuxThreadData &data, const QString &argIdx) const {
-        const bool hasMinFreq = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuMinFreqArg);
-        const bool hasMaxFreq = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuMaxFreqArg);
-        const bool hasArgs = hasMinFreq || hasMaxFreq;
-
-        if (!hasArgs)
-            return;
+    void CliHelperLinux::setCPUFreq(const CpuThreadView &view) const {
+        const SettingValue &minSetting = cmdParser->getSetting(Setting::CpuMinFreq);
+        const SettingValue &maxSetting = cmdParser->getSetting(Setting::CpuMaxFreq);
+        const int count = static_cast<int>(view.count);
+        QList<int> reqMin = view.freqMin.values;
+        QList<int> reqMax = view.freqMax.values;
+        QList<int> boundMin(count);
+        QList<int> boundMax(count);
+        int *reqMinData = reqMin.data();
+        int *reqMaxData = reqMax.data();
+        int *boundMinData = boundMin.data();
+        int *boundMaxData = boundMax.data();
+        const int *limitMin = view.freqLimitMin.values.constData();
+        const int *limitMax = view.freqLimitMax.values.constData();
+        const int *curMin = view.freqMin.values.constData();
+        const int *curMax = view.freqMax.values.constData();
+        PWTS::LNX::LinuxThreadData *threadData = packetData->threadData.data();
+
+        // requested values, current ones where not given
+        for (int i=0; i<count; ++i) {
+            if (const std::optional<int> value = minSetting.intAt(i))
+                reqMinData[i] = *value;
+
+            if (const std::optional<int> value = maxSetting.intAt(i))
+                reqMaxData[i] = *value;
+        }
 
-        if (!data.cpuFrequencyLimits.isValid() || !data.cpuFrequency.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
-            return;
+        for (int i=0; i<count; ++i) {
+            boundMinData[i] = qBound(limitMin[i], reqMinData[i], limitMax[i]);
+            boundMaxData[i] = qBound(limitMin[i], reqMaxData[i], limitMax[i]);
         }
 
-        const PWTS::LNX::CPUFrequencyLimits limits = data.cpuFrequencyLimits.getValue();
-        PWTS::MinMax freq = data.cpuFrequency.getValue();
+        for (int i=0; i<count; ++i) {
+            if (!view.freqMin.valid[i] || !view.freqLimitMin.valid[i]) {
+                logger->write(QString("invalid data in packet for cpu %1").arg(i));
+                continue;
+            }
 
-        if (hasMinFreq) {
-            const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuMinFreqArg).toHash();
+            // report clamped values
+            if (boundMinData[i] != reqMinData[i])
+                boundMinData[i] = boundSetting(Setting::CpuMinFreq, limitMin[i], reqMinData[i], limitMax[i], i);
 
-            if (argData.contains("all"))
-                freq.min = argData["all"].toInt();
-            else if (argData.contains(argIdx))
-                freq.min = argData[argIdx].toInt();
-        }
+            if (boundMaxData[i] != reqMaxData[i])
+                boundMaxData[i] = boundSetting(Setting::CpuMaxFreq, limitMin[i], reqMaxData[i], limitMax[i], i);
 
-        if (hasMaxFreq) {
-            const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuMaxFreqArg).toHash();
+            if (diffApply && boundMinData[i] == curMin[i] && boundMaxData[i] == curMax[i])
+                continue;
 
-            if (argData.contains("all"))
-                freq.max = argData["all"].toInt();
-            else if (argData.contains(argIdx))
-                freq.max = argData[argIdx].toInt();
+            setData(threadData[i].cpuFrequency, {boundMinData[i], boundMaxData[i]});
         }
-
-        data.cpuFrequency.setValue({
-            qBound(limits.limit.min, freq.min, limits.limit.max),
-            qBound(limits.limit.min, freq.max, limits.limit.max),
-        }, true);
     }
 
-    void CliHelperLinux::setCPUScalingGovernor(PWTS::LNX::LinuxThreadData &data, const QString &argIdx) const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuScalingGovernorArg))
+    void CliHelperLinux::setCPUScalingGovernor(PWTS::LNX::LinuxThreadData &data, const int idx) const {
+        if (!cmdParser->hasSetting(Setting::CpuScalingGovernor))
             return;
 
         if (!data.scalingAvailableGovernors.isValid() || !data.scalingGovernor.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
+            logger->write(QString("invalid data in packet for cpu %1").arg(idx));
             return;
         }
 
-        const QHash<QString, QVariant> argData = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuScalingGovernorArg).toHash();
+        const std::optional<QString> value = cmdParser->getSetting(Setting::CpuScalingGovernor).stringAt(idx);
         const QList<QString> validList = data.scalingAvailableGovernors.getValue().availableGovernors;
         QString gov;
 
-        if (argData.contains("all"))
-            gov = argData["all"].toString();
-        else if (argData.contains(argIdx))
-            gov = argData[argIdx].toString();
+        if (value)
+            gov = *value;
         else
             return;
 
         if (validList.contains(gov))
-            data.scalingGovernor.setValue(gov, true);
+            setData(data.scalingGovernor, gov);
         else
-            logInvalidValue(cpuScalingGovernorArg, gov);
+            logInvalidValue(Setting::CpuScalingGovernor, gov);
     }
 
     void CliHelperLinux::setIntelGPUData(PWTS::LNX::LinuxIntelGPUData &data, const int idx) const {
-        const QSet<PWTS::Feature> &gpuFeats = features.gpus[idx].second;
-        const QString &argIdx = QString::number(idx);
+        if (features.gpu(idx, PWTS::Feature::INTEL_GPU_SYSFS_GROUP)) {
+            if (features.gpu(idx, PWTS::Feature::INTEL_GPU_RPS_FREQ_SYSFS))
+                setIntelGPURpsFreq(data, idx);
 
-        if (gpuFeats.contains(PWTS::Feature::INTEL_GPU_SYSFS_GROUP)) {
-            if (gpuFeats.contains(PWTS::Feature::INTEL_GPU_RPS_FREQ_SYSFS))
-                setIntelGPURpsFreq(data, argIdx);
-
-            if (gpuFeats.contains(PWTS::Feature::INTEL_GPU_BOOST_SYSFS))
-                setIntelGPURpsMaxBoostFreq(data, argIdx);
+            if (features.gpu(idx, PWTS::Feature::INTEL_GPU_BOOST_SYSFS))
+                setIntelGPURpsMaxBoostFreq(data, idx);
         }
     }
 
     void CliHelperLinux::setAMDGPUData(PWTS::LNX::LinuxAMDGPUData &data, const int idx) const {
-        const QSet<PWTS::Feature> &gpuFeats = features.gpus[idx].second;
-        const QString &argIdx = QString::number(idx);
-
-        if (gpuFeats.contains(PWTS::Feature::AMD_GPU_SYSFS_GROUP)) {
-            if (gpuFeats.contains(PWTS::Feature::AMD_GPU_POWER_DPM_STATE_SYSFS))
-                setAMDGPUPowerDPMState(data, argIdx);
+        if (features.gpu(idx, PWTS::Feature::AMD_GPU_SYSFS_GROUP)) {
+            if (features.gpu(idx, PWTS::Feature::AMD_GPU_POWER_DPM_STATE_SYSFS))
+                setAMDGPUPowerDPMState(data, idx);
 
-            if (gpuFeats.contains(PWTS::Feature::AMD_GPU_DPM_FORCE_PERF_LEVEL_SYSFS))
-                setAMDGPUPowerDPMForcePerfLevel(data, argIdx);
+            if (features.gpu(idx, PWTS::Feature::AMD_GPU_DPM_FORCE_PERF_LEVEL_SYSFS))
+                setAMDGPUPowerDPMForcePerfLevel(data, idx);
         }
     }
 
-    void CliHelperLinux::setThreadData(PWTS::LNX::LinuxThreadData &data, const QString &argIdx) const {
-        if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::CPU_PARK_SYSFS))
-                setCPUOfflineStatus(data, argIdx);
+    void CliHelperLinux::setThreadData(PWTS::LNX::LinuxThreadData &data, const int idx) const {
+        if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
+            if (features.cpu(PWTS::Feature::CPU_PARK_SYSFS))
+                setCPUOfflineStatus(data, idx);
 
-            if (features.cpu.contains(PWTS::Feature::CPUFREQ_SYSFS)) {
-                setCPUFreq(data, argIdx);
-                setCPUScalingGovernor(data, argIdx);
-            }
+            if (features.cpu(PWTS::Feature::CPUFREQ_SYSFS))
+                setCPUScalingGovernor(data, idx);
         }
     }
 
     void CliHelperLinux::setClientPacketData() {
-        if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
-            if (cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, smtStateArg) && features.cpu.contains(PWTS::Feature::CPU_SMT_SYSFS))
+        skipData(packetData->smtState, packetData->cpuIdleGovernor);
+
+        if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
+            if (cmdParser->hasSetting(Setting::SmtState) && features.cpu(PWTS::Feature::CPU_SMT_SYSFS))
                 setSMTState();
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cpuIdleGovernorArg) && features.cpu.contains(PWTS::Feature::CPUIDLE_GOV_SYSFS))
+            if (cmdParser->hasSetting(Setting::CpuIdleGovernor) && features.cpu(PWTS::Feature::CPUIDLE_GOV_SYSFS))
                 setCPUIdleGovernor();
         }
 
-        if (cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, blockDevQueSchedArg))
+        if (cmdParser->hasSetting(Setting::BlockDevQueSched))
             setBlockQueueSchedulers();
+        else if (diffApply)
+            packetData->blockDevicesQueSched.clear();
 
-        if (cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, miscPmDevsArg))
+        if (cmdParser->hasSetting(Setting::MiscPmDevs))
             setMiscPmDevs();
+        else if (diffApply)
+            packetData->miscPMDevices.clear();
 
         for (const auto &[gpuIdx, gpuData]: packetData->intelGpuData.asKeyValueRange()) {
-            if (features.gpus.contains(gpuIdx))
+            skipData(gpuData.frequency, gpuData.boostFrequency);
+
+            if (features.hasGPU(gpuIdx))
                 setIntelGPUData(gpuData, gpuIdx);
             else
                 logger->write(QString("Intel GPU %1: no features for this GPU").arg(gpuIdx));
@@ -404,7 +426,9 @@ namespace PWT::CLI {
         }
 
         for (const auto &[gpuIdx, gpuData]: packetData->amdGpuData.asKeyValueRange()) {
-            if (features.gpus.contains(gpuIdx))
+            skipData(gpuData.powerDpmState, gpuData.dpmForcePerfLevel);
+
+            if (features.hasGPU(gpuIdx))
                 setAMDGPUData(gpuData, gpuIdx);
             else
                 logger->write(QString("AMD GPU %1: no features for this GPU").arg(gpuIdx));
@@ -413,16 +437,30 @@ namespace PWT::CLI {
             gpuData.odRanges = {};
         }
 
-        for (int i=0,l=packetData->threadData.size(); i<l; ++i) {
-            PWTS::LNX::LinuxThreadData &thd = packetData->threadData[i];
+        const bool hasFreqArgs = cmdParser->hasSetting(Setting::CpuMinFreq) || cmdParser->hasSetting(Setting::CpuMaxFreq);
+        const bool setFreq = hasFreqArgs && features.cpu(PWTS::Feature::SYSFS_GROUP) && features.cpu(PWTS::Feature::CPUFREQ_SYSFS);
+        PWTS::LNX::LinuxThreadData *threadData = packetData->threadData.data();
+        CpuThreadView freqView = CpuThreadView::frequencyView(setFreq ? packetData->threadData.size() : 0);
+        CpuThreadView *view = &freqView;
 
-            setThreadData(thd, QString::number(i));
+        forEachIndex(packetData->threadData.size(), [this, threadData, view](const int i) {
+            PWTS::LNX::LinuxThreadData &thd = threadData[i];
+
+            skipData(thd.cpuOnlineStatus, thd.cpuFrequency, thd.scalingGovernor);
+            setThreadData(thd, i);
+
+            if (i < view->count)
+                view->setLinuxFrequency(i, thd);
 
             // delete ro data for this cpu
             thd.coreID = {};
             thd.cpuFrequencyLimits = {};
             thd.scalingAvailableGovernors = {};
             thd.cpuLogicalOffAvailable = {};
-        }
+        });
+
+        // frequencies of all cpus are clamped and compared on the view columns
+        if (setFreq)
+            setCPUFreq(freqView);
     }
 }
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../../CliHelper.h"
+#include "../../../Classes/CpuThreadView.h"
 #include "pwtShared/Include/Data/OS/Linux/LinuxData.h"
 
 namespace PWT::CLI {
@@ -29,19 +30,19 @@ namespace PWT::CLI {
         void setMiscPmDevs() const;
         void setSMTState() const;
         void setCPUIdleGovernor() const;
-        void setIntelGPURpsFreq(PWTS::LNX::LinuxIntelGPUData &data, const QString &argIdx) const;
-        void setIntelGPURpsMaxBoostFreq(PWTS::LNX::LinuxIntelGPUData &data, const QString &argIdx) const;
-        void setAMDGPUPowerDPMState(PWTS::LNX::LinuxAMDGPUData &data, const QString &argIdx) const;
-        void setAMDGPUPowerDPMForcePerfLevel(PWTS::LNX::LinuxAMDGPUData &data, const QString &argIdx) const;
-        void setCPUOfflineStatus(PWTS::LNX::LinuxThreadData &data, const QString &argIdx) const;
-        void setCPUFreq(PWTS::LNX::LinuxThreadData &data, const QString &argIdx) const;
-        void setCPUScalingGovernor(PWTS::LNX::LinuxThreadData &data, const QString &argIdx) const;
+        void setIntelGPURpsFreq(PWTS::LNX::LinuxIntelGPUData &data, const int idx) const;
+        void setIntelGPURpsMaxBoostFreq(PWTS::LNX::LinuxIntelGPUData &data, const int idx) const;
+        void setAMDGPUPowerDPMState(PWTS::LNX::LinuxAMDGPUData &data, const int idx) const;
+        void setAMDGPUPowerDPMForcePerfLevel(PWTS::LNX::LinuxAMDGPUData &data, const int idx) const;
+        void setCPUOfflineStatus(PWTS::LNX::LinuxThreadData &data, const int idx) const;
+        void setCPUFreq(const CpuThreadView &view) const;
+        void setCPUScalingGovernor(PWTS::LNX::LinuxThreadData &data, const int idx) const;
         void setIntelGPUData(PWTS::LNX::LinuxIntelGPUData &data, int idx) const;
         void setAMDGPUData(PWTS::LNX::LinuxAMDGPUData &data, int idx) const;
-        void setThreadData(PWTS::LNX::LinuxThreadData &data, const QString &argIdx) const;
+        void setThreadData(PWTS::LNX::LinuxThreadData &data, const int idx) const;
 
     public:
-        CliHelperLinux(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures, const QSharedPointer<PWTS::LNX::LinuxData> &data);
+        CliHelperLinux(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures, const QSharedPointer<PWTS::LNX::LinuxData> &data);
 
         void setClientPacketData() override;
     };
@@ -16,16 +16,15 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "CliHelperLinuxAMD.h"
-#include "../../../CMDParser/SettingsArguments.h"
 
 namespace PWT::CLI {
-    CliHelperLinuxAMD::CliHelperLinuxAMD(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures,
+    CliHelperLinuxAMD::CliHelperLinuxAMD(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures,
                                             const QSharedPointer<PWTS::LNX::AMD::LinuxAMDData> &data): CliHelper(cmd, daemonFeatures) {
         packetData = data;
     }
 
     void CliHelperLinuxAMD::setPstateStatus() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pstateStatusArg))
+        if (!cmdParser->hasSetting(Setting::PstateStatus))
             return;
 
         if (!packetData->pstateStatus.isValid()) {
@@ -33,60 +32,63 @@ namespace PWT::CLI {
             return;
         }
 
-        const QString status = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pstateStatusArg).toString();
+        const QString status = cmdParser->getSetting(Setting::PstateStatus).toString();
         const QList<QString> validList = {"disable", "active", "passive", "guided"};
 
         if (validList.contains(status))
-            packetData->pstateStatus.setValue(status, true);
+            setData(packetData->pstateStatus, status);
         else
-            logInvalidValue(pstateStatusArg, status);
+            logInvalidValue(Setting::PstateStatus, status);
     }
 
-    void CliHelperLinuxAMD::setPstateEpp(PWTS::LNX::AMD::LinuxAMDThreadData &data, const QString &argIdx) const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pstateEppArg))
+    void CliHelperLinuxAMD::setPstateEpp(PWTS::LNX::AMD::LinuxAMDThreadData &data, const int idx) const {
+        if (!cmdParser->hasSetting(Setting::PstateEpp))
             return;
 
         if (!data.epp.isValid() || !data.pstateData.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
+            logger->write(QString("invalid data in packet for cpu %1").arg(idx));
             return;
         }
 
-        const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pstateEppArg).toHash();
+        const std::optional<QString> value = cmdParser->getSetting(Setting::PstateEpp).stringAt(idx);
         QString epp;
 
-        if (args.contains("all"))
-            epp = args["all"].toString();
-        else if (args.contains(argIdx))
-            epp = args[argIdx].toString();
+        if (value)
+            epp = *value;
 
         if (!data.pstateData.getValue().eppAvailablePrefs.contains(epp)) {
-            logInvalidValue(pstateEppArg, epp);
+            logInvalidValue(Setting::PstateEpp, epp);
             return;
         }
 
-        data.epp.setValue(epp, true);
+        setData(data.epp, epp);
     }
 
-    void CliHelperLinuxAMD::setThreadData(PWTS::LNX::AMD::LinuxAMDThreadData &data, const QString &argIdx) const {
-        if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::AMD_PSTATE_SYSFS))
-                setPstateEpp(data, argIdx);
+    void CliHelperLinuxAMD::setThreadData(PWTS::LNX::AMD::LinuxAMDThreadData &data, const int idx) const {
+        if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
+            if (features.cpu(PWTS::Feature::AMD_PSTATE_SYSFS))
+                setPstateEpp(data, idx);
         }
     }
 
     void CliHelperLinuxAMD::setClientPacketData() {
-        if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::AMD_PSTATE_SYSFS))
+        skipData(packetData->pstateStatus);
+
+        if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
+            if (features.cpu(PWTS::Feature::AMD_PSTATE_SYSFS))
                 setPstateStatus();
         }
 
-        for (int i=0,l=packetData->threadData.size(); i<l; ++i) {
-            PWTS::LNX::AMD::LinuxAMDThreadData &thd = packetData->threadData[i];
+        PWTS::LNX::AMD::LinuxAMDThreadData *threadData = packetData->threadData.data();
+
+        forEachIndex(packetData->threadData.size(), [this, threadData](const int i) {
+            PWTS::LNX::AMD::LinuxAMDThreadData &thd = threadData[i];
 
-            setThreadData(thd, QString::number(i));
+            skipData(thd.epp);
+            setThreadData(thd, i);
 
             // delete ro data for this cpu
             thd.pstateData = {};
-        }
+        });
     }
 }
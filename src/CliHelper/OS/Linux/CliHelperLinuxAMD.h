@@ -26,11 +26,11 @@ namespace PWT::CLI {
         QSharedPointer<PWTS::LNX::AMD::LinuxAMDData> packetData;
 
         void setPstateStatus() const;
-        void setPstateEpp(PWTS::LNX::AMD::LinuxAMDThreadData &data, const QString &argIdx) const;
-        void setThreadData(PWTS::LNX::AMD::LinuxAMDThreadData &data, const QString &argIdx) const;
+        void setPstateEpp(PWTS::LNX::AMD::LinuxAMDThreadData &data, const int idx) const;
+        void setThreadData(PWTS::LNX::AMD::LinuxAMDThreadData &data, const int idx) const;
 
     public:
-        CliHelperLinuxAMD(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures, const QSharedPointer<PWTS::LNX::AMD::LinuxAMDData> &data);
+        CliHelperLinuxAMD(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures, const QSharedPointer<PWTS::LNX::AMD::LinuxAMDData> &data);
 
         void setClientPacketData() override;
     };
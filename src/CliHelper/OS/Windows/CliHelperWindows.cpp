@@ -18,10 +18,9 @@
 #include <QRegularExpression>
 
 #include "CliHelperWindows.h"
-#include "../../../CMDParser/SettingsArguments.h"
 
 namespace PWT::CLI {
-    CliHelperWindows::CliHelperWindows(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures, const QSharedPointer<PWTS::WIN::WindowsData> &data): CliHelper(cmd, daemonFeatures) {
+    CliHelperWindows::CliHelperWindows(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures, const QSharedPointer<PWTS::WIN::WindowsData> &data): CliHelper(cmd, daemonFeatures) {
         packetData = data;
     }
 
@@ -46,6 +45,7 @@ namespace PWT::CLI {
 
         packetData->schemes.insert(tmpGuid, packetData->schemes[base]);
         packetData->schemes[tmpGuid].friendlyName = name;
+        ++changes;
     }
 
     void CliHelperWindows::copyPowerSchemeSettings() const {
@@ -98,21 +98,25 @@ namespace PWT::CLI {
                     val.dc = setting.value.dc;
             }
 
+            if (isSameValue(val, packetData->schemes[toScheme].settings[settingGuid].value))
+                continue;
+
             packetData->schemes[toScheme].settings[settingGuid].value = val;
+            ++changes;
         }
     }
 
     void CliHelperWindows::setPowerSchemes() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerSchemeArg) || packetData->schemes.isEmpty() || packetData->schemeOptionsData.isEmpty())
+        if (!cmdParser->hasSetting(Setting::PowerScheme) || packetData->schemes.isEmpty() || packetData->schemeOptionsData.isEmpty())
             return;
 
-        const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerSchemeArg).toHash();
+        const QHash<QString, SettingValue::Value> &args = cmdParser->getSetting(Setting::PowerScheme).entries();
 
         for (const auto &[arg, value]: args.asKeyValueRange()) {
             const QList<QString> settingData = arg.split(';');
 
             if (settingData.size() < 3) {
-                logger->write(QString("%1: invalid argument: %2").arg(powerSchemeArg, arg));
+                logger->write(QString("%1: invalid argument: %2").arg(settingName(Setting::PowerScheme), arg));
                 continue;
             }
 
@@ -124,34 +128,41 @@ namespace PWT::CLI {
                 scheme = QString("{guid-tbd-%1}").arg(settingData[0]);
 
                 if (!packetData->schemes.contains(scheme)) {
-                    logger->write(QString("%1: scheme not found: %2").arg(powerSchemeArg, scheme));
+                    logger->write(QString("%1: scheme not found: %2").arg(settingName(Setting::PowerScheme), scheme));
                     continue;
                 }
             }
 
             if (!packetData->schemes[scheme].settings.contains(setting)) {
-                logger->write(QString("%1: setting '%2' not found in scheme '%3'").arg(powerSchemeArg, setting, scheme));
+                logger->write(QString("%1: setting '%2' not found in scheme '%3'").arg(settingName(Setting::PowerScheme), setting, scheme));
                 continue;
 
             } else if (settingData[2] != "ac" && settingData[2] != "dc") {
-                logger->write(QString("%1: invalid mode for setting '%2' of scheme '%3'").arg(powerSchemeArg, settingData[2], setting, scheme));
+                logger->write(QString("%1: invalid mode for setting '%2' of scheme '%3'").arg(settingName(Setting::PowerScheme), settingData[2], setting, scheme));
                 continue;
             }
 
             settingVal = packetData->schemes[scheme].settings[setting].value;
 
             if (settingData[2] == "ac")
-                settingVal.ac = value.toInt();
+                settingVal.ac = std::get<int>(value);
             else
-                settingVal.dc = value.toInt();
+                settingVal.dc = std::get<int>(value);
+
+            if (isSameValue(settingVal, packetData->schemes[scheme].settings[setting].value))
+                continue;
 
             packetData->schemes[scheme].settings[setting].value = settingVal;
+            ++changes;
         }
     }
 
     void CliHelperWindows::setPowerSchemeFlags() const {
         packetData->replaceDefaultSchemes = cmdParser->isSet(CMDArg::SET_WIN_SCHEMES_REPLACE_DEFAULTS);
         packetData->resetSchemesDefault = cmdParser->isSet(CMDArg::SET_WIN_SCHEMES_RESET_DEFAULTS);
+
+        if (packetData->replaceDefaultSchemes || packetData->resetSchemesDefault)
+            ++changes;
     }
 
     void CliHelperWindows::setPowerSchemesDeleteFlag() const {
@@ -163,8 +174,10 @@ namespace PWT::CLI {
         for (const QString &guid: guidList) {
             const QString toFlag = QString("{%1}").arg(guid);
 
-            if (packetData->schemes.contains(toFlag))
+            if (packetData->schemes.contains(toFlag)) {
                 packetData->schemes[toFlag].deleteFlag = true;
+                ++changes;
+            }
         }
     }
 
@@ -177,8 +190,10 @@ namespace PWT::CLI {
         for (const QString &guid: guidList) {
             const QString toFlag = QString("{%1}").arg(guid);
 
-            if (packetData->schemes.contains(toFlag))
+            if (packetData->schemes.contains(toFlag)) {
                 packetData->schemes[toFlag].resetFlag = true;
+                ++changes;
+            }
         }
     }
 
@@ -192,14 +207,20 @@ namespace PWT::CLI {
         if (!packetData->schemes.contains(activeGuid)) // maybe temp user handle
             activeGuid = QString("{guid-tbd-%1}").arg(active);
 
-        if (packetData->schemes.contains(activeGuid) && !packetData->schemes[activeGuid].deleteFlag)
-            packetData->activeScheme = activeGuid;
-        else
+        if (!packetData->schemes.contains(activeGuid) || packetData->schemes[activeGuid].deleteFlag) {
             logger->write(QString("cannot set active scheme '%1': not found or flagged for deletion").arg(activeGuid));
+            return;
+
+        } else if (packetData->activeScheme == activeGuid) {
+            return;
+        }
+
+        packetData->activeScheme = activeGuid;
+        ++changes;
     }
 
     void CliHelperWindows::setClientPacketData() {
-    	if (features.cpu.contains(PWTS::Feature::PWR_SCHEME_GROUP)) {
+    	if (features.cpu(PWTS::Feature::PWR_SCHEME_GROUP)) {
     	    duplicatePowerScheme();
     	    copyPowerSchemeSettings();
     	    setPowerSchemes();
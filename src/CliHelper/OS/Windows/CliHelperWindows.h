@@ -34,7 +34,7 @@ namespace PWT::CLI {
         void setActivePowerScheme() const;
 
     public:
-        CliHelperWindows(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures, const QSharedPointer<PWTS::WIN::WindowsData> &data);
+        CliHelperWindows(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures, const QSharedPointer<PWTS::WIN::WindowsData> &data);
 
         void setClientPacketData() override;
     };
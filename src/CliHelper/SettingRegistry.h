@@ -0,0 +1,171 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QMap>
+#include <optional>
+#include <tuple>
+
+#include "../CMDParser/SettingsSchema.h"
+#include "pwtShared/Include/Features.h"
+#include "pwtClientCommon/InputRanges/InputRanges.h"
+
+namespace PWT::CLI {
+    // bounds of an int setting, values of unbounded settings are applied as given
+    struct SettingRange final {
+        using Getter = decltype(&UI::InputRanges::getIntelPl);
+
+        enum struct Source: int {
+            None,
+            Fixed,
+            Input
+        };
+
+        Source source = Source::None;
+        int min = 0;
+        int max = 0;
+        Getter getter = nullptr;
+
+        [[nodiscard]] static constexpr SettingRange fixed(const int min, const int max) { return {Source::Fixed, min, max, nullptr}; }
+        [[nodiscard]] static constexpr SettingRange input(const Getter getter) { return {Source::Input, 0, 0, getter}; }
+
+        [[nodiscard]] std::optional<SettingBounds> bounds(const UI::InputRanges &inputRanges) const {
+            switch (source) {
+                case Source::Fixed:
+                    return SettingBounds {min, max};
+                case Source::Input: {
+                    const PWTS::MinMax limit = (inputRanges.*getter)();
+
+                    return SettingBounds {limit.min, limit.max};
+                }
+                default:
+                    break;
+            }
+
+            return std::nullopt;
+        }
+    };
+
+    // what happens to packet data when its setting is not given
+    enum struct UnsetData: int {
+        Keep,
+        Ignore,
+        IgnoreUnreadable // ignored if the daemon can't read it
+    };
+
+    // setting applied to a whole packet data field of D
+    template<typename D, typename F>
+    struct FieldSetting final {
+        Setting setting;
+        PWTS::Feature feature; // write feature
+        F D::*field;
+        SettingRange range;
+        UnsetData unset;
+        PWTS::Feature readFeature;
+    };
+
+    // setting applied to a member of a register value V
+    template<typename V, typename M>
+    struct MemberSetting final {
+        Setting setting;
+        M V::*member;
+        SettingRange range;
+        std::optional<PWTS::Feature> feature; // required besides the register one
+    };
+
+    // packet data field of D holding a register, T is a tuple of MemberSetting
+    template<typename D, typename F, typename T>
+    struct RegisterSetting final {
+        PWTS::Feature feature;
+        F D::*field;
+        T members;
+    };
+
+    template<typename D, typename F>
+    [[nodiscard]] constexpr FieldSetting<D, F> fieldSetting(const Setting setting, const PWTS::Feature feature, F D::*field, const SettingRange range = {},
+                                                            const UnsetData unset = UnsetData::Keep, const PWTS::Feature readFeature = {}) {
+        return {setting, feature, field, range, unset, readFeature};
+    }
+
+    template<typename V, typename M>
+    [[nodiscard]] constexpr MemberSetting<V, M> memberSetting(const Setting setting, M V::*member, const SettingRange range = {},
+                                                              const std::optional<PWTS::Feature> feature = std::nullopt) {
+        return {setting, member, range, feature};
+    }
+
+    template<typename D, typename F, typename... M>
+    [[nodiscard]] constexpr RegisterSetting<D, F, std::tuple<M...>> registerSetting(const PWTS::Feature feature, F D::*field, const M... members) {
+        return {feature, field, std::make_tuple(members...)};
+    }
+
+    // bounds of the ranged settings of a registry, cached to validate settings without the device packet
+    inline void appendRanges(QMap<Setting, SettingBounds> &out, const Setting setting, const SettingRange &range, const UI::InputRanges &inputRanges) {
+        const std::optional<SettingBounds> bounds = range.bounds(inputRanges);
+
+        if (bounds)
+            out.insert(setting, *bounds);
+    }
+
+    template<typename D, typename F>
+    void appendRanges(QMap<Setting, SettingBounds> &out, const FieldSetting<D, F> &desc, const UI::InputRanges &inputRanges) {
+        appendRanges(out, desc.setting, desc.range, inputRanges);
+    }
+
+    template<typename V, typename M>
+    void appendRanges(QMap<Setting, SettingBounds> &out, const MemberSetting<V, M> &desc, const UI::InputRanges &inputRanges) {
+        appendRanges(out, desc.setting, desc.range, inputRanges);
+    }
+
+    template<typename... S>
+    void appendRanges(QMap<Setting, SettingBounds> &out, const std::tuple<S...> &registry, const UI::InputRanges &inputRanges) {
+        std::apply([&](const auto &...desc) { (appendRanges(out, desc, inputRanges), ...); }, registry);
+    }
+
+    template<typename D, typename F, typename T>
+    void appendRanges(QMap<Setting, SettingBounds> &out, const RegisterSetting<D, F, T> &desc, const UI::InputRanges &inputRanges) {
+        appendRanges(out, desc.members, inputRanges);
+    }
+
+    // features of the settings of a registry, cached to list the device settings without the helpers
+    inline void appendFeatures(QMap<Setting, SettingFeatures> &out, const Setting setting, const PWTS::Feature group, const PWTS::Feature feature) {
+        out.insert(setting, {group, feature});
+    }
+
+    template<typename D, typename F>
+    void appendFeatures(QMap<Setting, SettingFeatures> &out, const FieldSetting<D, F> &desc, const PWTS::Feature group) {
+        appendFeatures(out, desc.setting, group, desc.feature);
+    }
+
+    template<typename V, typename M>
+    void appendFeatures(QMap<Setting, SettingFeatures> &out, const MemberSetting<V, M> &desc, const PWTS::Feature group, const PWTS::Feature feature) {
+        if (desc.feature)
+            appendFeatures(out, desc.setting, feature, *desc.feature);
+        else
+            appendFeatures(out, desc.setting, group, feature);
+    }
+
+    template<typename... S, typename... A>
+    void appendFeatures(QMap<Setting, SettingFeatures> &out, const std::tuple<S...> &registry, const A... args) {
+        std::apply([&](const auto &...desc) { (appendFeatures(out, desc, args...), ...); }, registry);
+    }
+
+    template<typename D, typename F, typename T>
+    void appendFeatures(QMap<Setting, SettingFeatures> &out, const RegisterSetting<D, F, T> &desc, const PWTS::Feature group) {
+        appendFeatures(out, desc.members, group, desc.feature);
+    }
+}
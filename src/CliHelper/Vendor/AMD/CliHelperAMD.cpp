@@ -16,255 +16,62 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "CliHelperAMD.h"
-#include "../../../CMDParser/SettingsArguments.h"
 
 namespace PWT::CLI {
-    CliHelperAMD::CliHelperAMD(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures,
+    static constexpr auto ryzenAdjSettings = std::make_tuple(
+        fieldSetting(Setting::ApuSlow, PWTS::Feature::AMD_RY_APU_SLOW_W, &PWTS::AMD::AMDData::apuSlow,
+                        SettingRange::input(&UI::InputRanges::getRADJAPUSlow), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_APU_SLOW_R),
+        fieldSetting(Setting::StapmLimit, PWTS::Feature::AMD_RY_STAPM_LIMIT_W, &PWTS::AMD::AMDData::stapmLimit,
+                        SettingRange::input(&UI::InputRanges::getRADJPl)),
+        fieldSetting(Setting::SlowLimit, PWTS::Feature::AMD_RY_SLOW_LIMIT_W, &PWTS::AMD::AMDData::slowLimit,
+                        SettingRange::input(&UI::InputRanges::getRADJPl)),
+        fieldSetting(Setting::FastLimit, PWTS::Feature::AMD_RY_FAST_LIMIT_W, &PWTS::AMD::AMDData::fastLimit,
+                        SettingRange::input(&UI::InputRanges::getRADJPl)),
+        fieldSetting(Setting::TctlTemp, PWTS::Feature::AMD_RY_TCTL_TEMP_W, &PWTS::AMD::AMDData::tctlTemp,
+                        SettingRange::input(&UI::InputRanges::getRADJTctl), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_TCTL_TEMP_R),
+        fieldSetting(Setting::ApuSkinTemp, PWTS::Feature::AMD_RY_APU_SKIN_TEMP_W, &PWTS::AMD::AMDData::apuSkinTemp,
+                        SettingRange::input(&UI::InputRanges::getRADJAPUSkinTemp), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_APU_SKIN_TEMP_R),
+        fieldSetting(Setting::DgpuSkinTemp, PWTS::Feature::AMD_RY_DGPU_SKIN_TEMP_W, &PWTS::AMD::AMDData::dgpuSkinTemp,
+                        SettingRange::input(&UI::InputRanges::getRADJDGPUSkinTemp), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_DGPU_SKIN_TEMP_R),
+        fieldSetting(Setting::VrmCurrent, PWTS::Feature::AMD_RY_VRM_CURRENT_W, &PWTS::AMD::AMDData::vrmCurrent,
+                        SettingRange::input(&UI::InputRanges::getRADJVrmCurrent), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_VRM_CURRENT_R),
+        fieldSetting(Setting::VrmSocCurrent, PWTS::Feature::AMD_RY_VRM_SOC_CURRENT_W, &PWTS::AMD::AMDData::vrmSocCurrent,
+                        SettingRange::input(&UI::InputRanges::getRADJVrmSocCurrent), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_VRM_SOC_CURRENT_R),
+        fieldSetting(Setting::VrmMaxCurrent, PWTS::Feature::AMD_RY_VRM_MAX_CURRENT_W, &PWTS::AMD::AMDData::vrmMaxCurrent,
+                        SettingRange::input(&UI::InputRanges::getRADJVrmCurrent), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_VRM_MAX_CURRENT_R),
+        fieldSetting(Setting::VrmSocMaxCurrent, PWTS::Feature::AMD_RY_VRM_SOC_MAX_CURRENT_W, &PWTS::AMD::AMDData::vrmSocMaxCurrent,
+                        SettingRange::input(&UI::InputRanges::getRADJVrmSocCurrent), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_VRM_SOC_MAX_CURRENT_R),
+        fieldSetting(Setting::StaticGfxClk, PWTS::Feature::AMD_RY_STATIC_GFX_CLK_W, &PWTS::AMD::AMDData::staticGfxClock,
+                        SettingRange::input(&UI::InputRanges::getRADJGfxClock), UnsetData::Ignore),
+        fieldSetting(Setting::MinGfxClk, PWTS::Feature::AMD_RY_MIN_GFX_CLOCK_W, &PWTS::AMD::AMDData::minGfxClock,
+                        SettingRange::input(&UI::InputRanges::getRADJGfxClock), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_MIN_GFX_CLOCK_R),
+        fieldSetting(Setting::MaxGfxClk, PWTS::Feature::AMD_RY_MAX_GFX_CLOCK_W, &PWTS::AMD::AMDData::maxGfxClock,
+                        SettingRange::input(&UI::InputRanges::getRADJGfxClock), UnsetData::IgnoreUnreadable, PWTS::Feature::AMD_RY_MAX_GFX_CLOCK_R),
+        fieldSetting(Setting::CurveOptimizer, PWTS::Feature::AMD_RY_CO_ALL_W, &PWTS::AMD::AMDData::curveOptimizer,
+                        SettingRange::input(&UI::InputRanges::getRADJCO), UnsetData::Ignore)
+    );
+
+    static constexpr auto amdCpuSettings = std::make_tuple(
+        fieldSetting(Setting::CppcEnable, PWTS::Feature::AMD_CPPC, &PWTS::AMD::AMDData::cppcEnableBit, {}, UnsetData::Ignore)
+    );
+
+    static constexpr auto ryzenAdjCoreSettings = std::make_tuple(
+        fieldSetting(Setting::CurveOptimizerPer, PWTS::Feature::AMD_RY_CO_PER_W, &PWTS::AMD::AMDCoreData::curveOptimizer,
+                        SettingRange::input(&UI::InputRanges::getRADJCO), UnsetData::Ignore)
+    );
+
+    static constexpr auto amdThreadSettings = std::make_tuple(
+        fieldSetting(Setting::CorePerfBoost, PWTS::Feature::AMD_CORE_PERFORMANCE_BOOST, &PWTS::AMD::AMDThreadData::corePerfBoost)
+    );
+
+    CliHelperAMD::CliHelperAMD(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures,
                                 const QSharedPointer<PWTS::AMD::AMDData> &data, const QSharedPointer<UI::InputRanges> &ranges): CliHelper(cmd, daemonFeatures) {
         packetData = data;
         inputRanges = ranges;
     }
 
-    void CliHelperAMD::setApuSlow() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, apuSlowArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_APU_SLOW_R))
-                packetData->apuSlow.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->apuSlow.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJAPUSlow();
-
-        packetData->apuSlow.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, apuSlowArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setStapmLimit() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, stapmLimitArg))
-            return;
-
-        if (!packetData->stapmLimit.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJPl();
-
-        packetData->stapmLimit.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, stapmLimitArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setSlowLimit() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, slowLimitArg))
-            return;
-
-        if (!packetData->slowLimit.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJPl();
-
-        packetData->slowLimit.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, apuSlowArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setFastLimit() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, fastLimitArg))
-            return;
-
-        if (!packetData->fastLimit.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJPl();
-
-        packetData->fastLimit.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, fastLimitArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setTctlTemp() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, tctlTempArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_TCTL_TEMP_R))
-                packetData->tctlTemp.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->tctlTemp.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJTctl();
-
-        packetData->tctlTemp.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, tctlTempArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setApuSkinTemp() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, apuSkinTempArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_APU_SKIN_TEMP_R))
-                packetData->apuSkinTemp.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->apuSkinTemp.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJAPUSkinTemp();
-
-        packetData->apuSkinTemp.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, apuSkinTempArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setDgpuSkinTemp() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, dgpuSkinTempArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_DGPU_SKIN_TEMP_R))
-                packetData->dgpuSkinTemp.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->dgpuSkinTemp.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJDGPUSkinTemp();
-
-        packetData->dgpuSkinTemp.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, dgpuSkinTempArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setVrmCurrent() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrmCurrentArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_VRM_CURRENT_R))
-                packetData->vrmCurrent.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->vrmCurrent.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJVrmCurrent();
-
-        packetData->vrmCurrent.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrmCurrentArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setVrmSocCurrent() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrmSocCurrentArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_VRM_SOC_CURRENT_R))
-                packetData->vrmSocCurrent.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->vrmSocCurrent.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJVrmSocCurrent();
-
-        packetData->vrmSocCurrent.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrmSocCurrentArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setVrmMaxCurrent() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrmMaxCurrentArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_VRM_MAX_CURRENT_R))
-                packetData->vrmMaxCurrent.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->vrmMaxCurrent.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJVrmCurrent();
-
-        packetData->vrmMaxCurrent.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrmMaxCurrentArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setVrmSocMaxCurrent() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrmSocMaxCurrentArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_VRM_SOC_MAX_CURRENT_R))
-                packetData->vrmSocMaxCurrent.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->vrmSocMaxCurrent.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJVrmSocCurrent();
-
-        packetData->vrmSocMaxCurrent.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrmSocMaxCurrentArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setStaticGfxClock() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, staticGfxClkArg)) {
-            packetData->staticGfxClock.setIgnored(true);
-            return;
-        }
-
-        if (!packetData->staticGfxClock.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJGfxClock();
-
-        packetData->staticGfxClock.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, staticGfxClkArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setMinGfxClock() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, minGfxClkArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_MIN_GFX_CLOCK_R))
-                packetData->minGfxClock.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->minGfxClock.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJGfxClock();
-
-        packetData->minGfxClock.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, minGfxClkArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setMaxGfxClock() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, maxGfxClkArg)) {
-            if (!features.cpu.contains(PWTS::Feature::AMD_RY_MAX_GFX_CLOCK_R))
-                packetData->maxGfxClock.setIgnored(true);
-
-            return;
-        }
-
-        if (!packetData->maxGfxClock.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJGfxClock();
-
-        packetData->maxGfxClock.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, maxGfxClkArg).toInt(), range.max), true);
-    }
-
     void CliHelperAMD::setPowerProfile() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, amdPowerProfileArg)) {
+        if (!cmdParser->hasSetting(Setting::AmdPowerProfile)) {
             packetData->powerProfile.setIgnored(true);
             return;
         }
@@ -274,253 +81,163 @@ namespace PWT::CLI {
             return;
         }
 
-        const int profile = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, amdPowerProfileArg).toInt();
+        const int profile = cmdParser->getSetting(Setting::AmdPowerProfile).toInt();
 
         if (profile != 0 && profile != 1) {
-            logInvalidValue(amdPowerProfileArg, QString::number(profile));
+            logInvalidValue(Setting::AmdPowerProfile, QString::number(profile));
             return;
         }
 
-        packetData->powerProfile.setValue(profile, true);
+        setData(packetData->powerProfile, profile);
     }
 
-    void CliHelperAMD::setCOAll() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, curveOptimizerArg)) {
-            packetData->curveOptimizer.setIgnored(true);
-            return;
-        }
-
-        if (!packetData->curveOptimizer.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const PWTS::MinMax range = inputRanges->getRADJCO();
-
-        packetData->curveOptimizer.setValue(qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, curveOptimizerArg).toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setCPPCEnable() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcEnableArg)) {
-            packetData->cppcEnableBit.setIgnored(true);
-            return;
-        }
-
-        if (!packetData->cppcEnableBit.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        packetData->cppcEnableBit.setValue(cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcEnableArg).toBool(), true);
-    }
-
-    void CliHelperAMD::setCOPer(PWTS::AMD::AMDCoreData &data, const QString &argIdx) const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, curveOptimizerPerArg)) {
-            data.curveOptimizer.setIgnored(true);
-            return;
-        }
-
-        if (!data.curveOptimizer.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
-            return;
-        }
-
-        const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, curveOptimizerPerArg).toHash();
-        const PWTS::MinMax range = inputRanges->getRADJCO();
-
-        if (args.contains("all"))
-            data.curveOptimizer.setValue(qBound(range.min, args["all"].toInt(), range.max), true);
-        else if (args.contains(argIdx))
-            data.curveOptimizer.setValue(qBound(range.min, args[argIdx].toInt(), range.max), true);
-    }
-
-    void CliHelperAMD::setHwPstate(PWTS::AMD::AMDThreadData &data, const QString &argIdx, const PWTS::AMD::PStateCurrentLimit &limits) const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pstateCmdArg))
+    void CliHelperAMD::setHwPstate(PWTS::AMD::AMDThreadData &data, const int idx, const PWTS::AMD::PStateCurrentLimit &limits) const {
+        if (!cmdParser->hasSetting(Setting::PstateCmd))
             return;
 
         if (!data.pstateCmd.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
+            logger->write(QString("invalid data in packet for cpu %1").arg(idx));
             return;
         }
 
-        const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pstateCmdArg).toHash();
+        const std::optional<int> value = cmdParser->getSetting(Setting::PstateCmd).intAt(idx);
 
-        if (args.contains("all"))
-            data.pstateCmd.setValue(qBound(limits.curPStateLimit, args["all"].toInt(), limits.pstateMaxValue), true);
-        else if (args.contains(argIdx))
-            data.pstateCmd.setValue(qBound(limits.curPStateLimit, args[argIdx].toInt(), limits.pstateMaxValue), true);
+        if (value)
+            setData(data.pstateCmd, boundSetting(Setting::PstateCmd, limits.curPStateLimit, *value, limits.pstateMaxValue, idx));
     }
 
-    void CliHelperAMD::setCorePerfBoost(PWTS::AMD::AMDThreadData &data, const QString &argIdx) const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, corePerfBoostArg))
-            return;
-
-        if (!data.corePerfBoost.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
-            return;
-        }
-
-        const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, corePerfBoostArg).toHash();
-
-        if (args.contains("all"))
-            data.corePerfBoost.setValue(args["all"].toInt(), true);
-        else if (args.contains(argIdx))
-            data.corePerfBoost.setValue(args[argIdx].toInt(), true);
+    bool CliHelperAMD::hasCPPCArgs() const {
+        return cmdParser->hasSetting(Setting::CppcRequestMinPerf) || cmdParser->hasSetting(Setting::CppcRequestMaxPerf) ||
+                cmdParser->hasSetting(Setting::CppcRequestDesiredPerf) || cmdParser->hasSetting(Setting::CppcRequestEpp);
     }
 
-    void CliHelperAMD::setCPPCRequest(PWTS::AMD::AMDThreadData &data, const QString &argIdx) const {
-        const bool hasMin = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcRequestMinPerfArg);
-        const bool hasMax = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcRequestMaxPerfArg);
-        const bool hasDesired = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcRequestDesiredPerfArg);
-        const bool hasEpp = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcRequestEppArg);
-        const bool hasArgs = hasMin || hasMax || hasDesired || hasEpp;
+    void CliHelperAMD::setCPPCRequest(const CpuThreadView &view) const {
+        PWTS::AMD::AMDThreadData *threadData = packetData->threadData.data();
 
-        if (!hasArgs) {
-            data.cppcRequest.setIgnored(true);
-            return;
-        }
+        if (!hasCPPCArgs()) {
+            for (PWTS::AMD::AMDThreadData &thd: packetData->threadData)
+                thd.cppcRequest.setIgnored(true);
 
-        if (!data.cppcRequest.isValid() || !data.cppcCapability1.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
             return;
         }
 
-        const PWTS::AMD::CPPCCapability1 caps = data.cppcCapability1.getValue();
-        PWTS::AMD::CPPCRequest req = data.cppcRequest.getValue();
-
-        if (hasMin) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcRequestMinPerfArg).toHash();
-
-            if (args.contains("all"))
-                req.minPerf = qBound(caps.lowestPerf, args["all"].toInt(), caps.highestPerf);
-            else if (args.contains(argIdx))
-                req.minPerf = qBound(caps.lowestPerf, args[argIdx].toInt(), caps.highestPerf);
-        }
+        const int count = static_cast<int>(view.count);
+        QList<bool> valid(count);
 
-        if (hasMax) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcRequestMaxPerfArg).toHash();
+        for (int i=0; i<count; ++i)
+            valid[i] = view.cppcMin.valid[i] && view.cppcLowest.valid[i];
 
-            if (args.contains("all"))
-                req.maxPerf = qBound(caps.lowestPerf, args["all"].toInt(), caps.highestPerf);
-            else if (args.contains(argIdx))
-                req.maxPerf = qBound(caps.lowestPerf, args[argIdx].toInt(), caps.highestPerf);
-        }
+        const QList<int> minPerf = boundColumn(Setting::CppcRequestMinPerf, view.cppcMin.values, valid, view.cppcLowest.values, view.cppcHighest.values);
+        const QList<int> maxPerf = boundColumn(Setting::CppcRequestMaxPerf, view.cppcMax.values, valid, view.cppcLowest.values, view.cppcHighest.values);
+        const QList<int> desPerf = boundColumn(Setting::CppcRequestDesiredPerf, view.cppcDesired.values, valid, view.cppcLowest.values, view.cppcHighest.values);
+        const QList<int> epp = boundColumn(Setting::CppcRequestEpp, view.cppcEpp.values, valid, QList<int>(count, 0), QList<int>(count, 255));
 
-        if (hasDesired) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcRequestDesiredPerfArg).toHash();
+        for (int i=0; i<count; ++i) {
+            if (!valid[i]) {
+                logger->write(QString("invalid data in packet for cpu %1").arg(i));
+                continue;
+            }
 
-            if (args.contains("all"))
-                req.desPerf = qBound(caps.lowestPerf, args["all"].toInt(), caps.highestPerf);
-            else if (args.contains(argIdx))
-                req.desPerf = qBound(caps.lowestPerf, args[argIdx].toInt(), caps.highestPerf);
-        }
+            // compared on the columns, unchanged cpus are not read back from the packet
+            if (diffApply && minPerf[i] == view.cppcMin.values[i] && maxPerf[i] == view.cppcMax.values[i] &&
+                desPerf[i] == view.cppcDesired.values[i] && epp[i] == view.cppcEpp.values[i])
+                continue;
 
-        if (hasEpp) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cppcRequestEppArg).toHash();
+            PWTS::AMD::CPPCRequest req = threadData[i].cppcRequest.getValue();
 
-            if (args.contains("all"))
-                req.desPerf = qBound(0, args["all"].toInt(), 255);
-            else if (args.contains(argIdx))
-                req.desPerf = qBound(0, args[argIdx].toInt(), 255);
+            req.minPerf = minPerf[i];
+            req.maxPerf = maxPerf[i];
+            req.desPerf = desPerf[i];
+            req.epp = epp[i];
+            setData(threadData[i].cppcRequest, req);
         }
-
-        data.cppcRequest.setValue(req, true);
     }
 
-    void CliHelperAMD::setCoreData(PWTS::AMD::AMDCoreData &data, const QString &argIdx) const {
-        if (features.cpu.contains(PWTS::Feature::AMD_CPU_RY_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_CO_PER_W))
-                setCOPer(data, argIdx);
-        }
+    void CliHelperAMD::setCoreData(PWTS::AMD::AMDCoreData &data, const int idx) const {
+        if (features.cpu(PWTS::Feature::AMD_CPU_RY_GROUP))
+            setFields(data, ryzenAdjCoreSettings, idx);
     }
 
-    void CliHelperAMD::setThreadData(PWTS::AMD::AMDThreadData &data, const QString &argIdx) const {
-        if (features.cpu.contains(PWTS::Feature::AMD_CPU_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::AMD_HWPSTATE)) {
+    void CliHelperAMD::setThreadData(PWTS::AMD::AMDThreadData &data, const int idx) const {
+        if (features.cpu(PWTS::Feature::AMD_CPU_GROUP)) {
+            if (features.cpu(PWTS::Feature::AMD_HWPSTATE)) {
                 if (packetData->pstateCurrentLimit.isValid())
-                    setHwPstate(data, argIdx, packetData->pstateCurrentLimit.getValue());
+                    setHwPstate(data, idx, packetData->pstateCurrentLimit.getValue());
                 else
-                    logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
+                    logger->write(QString("invalid data in packet for cpu %1").arg(idx));
             }
 
-            if (features.cpu.contains(PWTS::Feature::AMD_CORE_PERFORMANCE_BOOST))
-                setCorePerfBoost(data, argIdx);
-
-            if (features.cpu.contains(PWTS::Feature::AMD_CPPC))
-                setCPPCRequest(data, argIdx);
+            setFields(data, amdThreadSettings, idx);
         }
     }
 
-    void CliHelperAMD::setClientPacketData() {
-        if (features.cpu.contains(PWTS::Feature::AMD_CPU_RY_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_APU_SLOW_W))
-                setApuSlow();
-
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_STAPM_LIMIT_W))
-                setStapmLimit();
-
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_SLOW_LIMIT_W))
-                setSlowLimit();
-
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_FAST_LIMIT_W))
-                setFastLimit();
-
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_TCTL_TEMP_W))
-                setTctlTemp();
-
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_APU_SKIN_TEMP_W))
-                setApuSkinTemp();
-
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_DGPU_SKIN_TEMP_W))
-                setDgpuSkinTemp();
-
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_VRM_CURRENT_W))
-                setVrmCurrent();
-
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_VRM_SOC_CURRENT_W))
-                setVrmSocCurrent();
+    void CliHelperAMD::appendSettingRanges(QMap<Setting, SettingBounds> &ranges, const UI::InputRanges &inputRanges) {
+        appendRanges(ranges, ryzenAdjSettings, inputRanges);
+        appendRanges(ranges, amdCpuSettings, inputRanges);
+        appendRanges(ranges, ryzenAdjCoreSettings, inputRanges);
+        appendRanges(ranges, amdThreadSettings, inputRanges);
+    }
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_VRM_MAX_CURRENT_W))
-                setVrmMaxCurrent();
+    void CliHelperAMD::appendSettingFeatures(QMap<Setting, SettingFeatures> &out) {
+        appendFeatures(out, ryzenAdjSettings, PWTS::Feature::AMD_CPU_RY_GROUP);
+        appendFeatures(out, amdCpuSettings, PWTS::Feature::AMD_CPU_GROUP);
+        appendFeatures(out, ryzenAdjCoreSettings, PWTS::Feature::AMD_CPU_RY_GROUP);
+        appendFeatures(out, amdThreadSettings, PWTS::Feature::AMD_CPU_GROUP);
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_VRM_SOC_MAX_CURRENT_W))
-                setVrmSocMaxCurrent();
+        // set by hand, see setPowerProfile, setThreadData and setCPPCRequest
+        appendFeatures(out, Setting::AmdPowerProfile, PWTS::Feature::AMD_CPU_RY_GROUP, PWTS::Feature::AMD_RY_POWER_PROFILE_W);
+        appendFeatures(out, Setting::PstateCmd, PWTS::Feature::AMD_CPU_GROUP, PWTS::Feature::AMD_HWPSTATE);
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_STATIC_GFX_CLK_W))
-                setStaticGfxClock();
+        for (const Setting setting: {Setting::CppcRequestMaxPerf, Setting::CppcRequestMinPerf, Setting::CppcRequestDesiredPerf, Setting::CppcRequestEpp})
+            appendFeatures(out, setting, PWTS::Feature::AMD_CPU_GROUP, PWTS::Feature::AMD_CPPC);
+    }
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_MIN_GFX_CLOCK_W))
-                setMinGfxClock();
+    void CliHelperAMD::setClientPacketData() {
+        skipData(packetData->apuSlow, packetData->stapmLimit, packetData->slowLimit, packetData->fastLimit,
+                    packetData->tctlTemp, packetData->apuSkinTemp, packetData->dgpuSkinTemp, packetData->vrmCurrent,
+                    packetData->vrmSocCurrent, packetData->vrmMaxCurrent, packetData->vrmSocMaxCurrent, packetData->staticGfxClock,
+                    packetData->minGfxClock, packetData->maxGfxClock, packetData->powerProfile, packetData->curveOptimizer,
+                    packetData->cppcEnableBit);
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_MAX_GFX_CLOCK_W))
-                setMaxGfxClock();
+        if (features.cpu(PWTS::Feature::AMD_CPU_RY_GROUP)) {
+            setFields(*packetData, ryzenAdjSettings);
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_POWER_PROFILE_W))
+            if (features.cpu(PWTS::Feature::AMD_RY_POWER_PROFILE_W))
                 setPowerProfile();
-
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_CO_ALL_W))
-                setCOAll();
         }
 
-        if (features.cpu.contains(PWTS::Feature::AMD_CPU_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::AMD_CPPC))
-                setCPPCEnable();
-        }
+        if (features.cpu(PWTS::Feature::AMD_CPU_GROUP))
+            setFields(*packetData, amdCpuSettings);
 
-        for (int i=0,l=packetData->coreData.size(); i<l; ++i) {
-            PWTS::AMD::AMDCoreData &cdata = packetData->coreData[i];
+        PWTS::AMD::AMDCoreData *coreData = packetData->coreData.data();
+        PWTS::AMD::AMDThreadData *threadData = packetData->threadData.data();
+        const bool hasCppc = features.cpu(PWTS::Feature::AMD_CPU_GROUP) && features.cpu(PWTS::Feature::AMD_CPPC);
+        CpuThreadView cppcView = CpuThreadView::cppcView(hasCppc && hasCPPCArgs() ? packetData->threadData.size() : 0);
+        CpuThreadView *view = &cppcView;
 
-            setCoreData(cdata, QString::number(i));
-        }
+        forEachIndex(packetData->coreData.size(), [this, coreData](const int i) {
+            PWTS::AMD::AMDCoreData &cdata = coreData[i];
+
+            skipData(cdata.curveOptimizer);
+            setCoreData(cdata, i);
+        });
 
-        for (int i=0,l=packetData->threadData.size(); i<l; ++i) {
-            PWTS::AMD::AMDThreadData &thd = packetData->threadData[i];
+        forEachIndex(packetData->threadData.size(), [this, threadData, view](const int i) {
+            PWTS::AMD::AMDThreadData &thd = threadData[i];
 
-            setThreadData(thd, QString::number(i));
+            skipData(thd.pstateCmd, thd.corePerfBoost, thd.cppcRequest);
+            setThreadData(thd, i);
+
+            if (i < view->count)
+                view->setAMDCppc(i, thd);
 
             // delete ro data for this cpu
             thd.cppcCapability1 = {};
-        }
+        });
+
+        // cppc requests of all cpus are clamped and compared on the view columns
+        if (hasCppc)
+            setCPPCRequest(cppcView);
 
         // delete ro package data
         packetData->pstateCurrentLimit = {};
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../../CliHelper.h"
+#include "../../../Classes/CpuThreadView.h"
 #include "pwtShared/Include/Data/Vendor/AMD/AMDData.h"
 #include "pwtClientCommon/InputRanges/InputRanges.h"
 
@@ -25,36 +26,21 @@ namespace PWT::CLI {
     class CliHelperAMD final: public CliHelper {
     private:
         QSharedPointer<PWTS::AMD::AMDData> packetData;
-        QSharedPointer<UI::InputRanges> inputRanges;
 
-        void setApuSlow() const;
-        void setStapmLimit() const;
-        void setSlowLimit() const;
-        void setFastLimit() const;
-        void setTctlTemp() const;
-        void setApuSkinTemp() const;
-        void setDgpuSkinTemp() const;
-        void setVrmCurrent() const;
-        void setVrmSocCurrent() const;
-        void setVrmMaxCurrent() const;
-        void setVrmSocMaxCurrent() const;
-        void setStaticGfxClock() const;
-        void setMinGfxClock() const;
-        void setMaxGfxClock() const;
         void setPowerProfile() const;
-        void setCOAll() const;
-        void setCPPCEnable() const;
-        void setCOPer(PWTS::AMD::AMDCoreData &data, const QString &argIdx) const;
-        void setHwPstate(PWTS::AMD::AMDThreadData &data, const QString &argIdx, const PWTS::AMD::PStateCurrentLimit &limits) const;
-        void setCorePerfBoost(PWTS::AMD::AMDThreadData &data, const QString &argIdx) const;
-        void setCPPCRequest(PWTS::AMD::AMDThreadData &data, const QString &argIdx) const;
-        void setCoreData(PWTS::AMD::AMDCoreData &data, const QString &argIdx) const;
-        void setThreadData(PWTS::AMD::AMDThreadData &data, const QString &argIdx) const;
+        void setHwPstate(PWTS::AMD::AMDThreadData &data, const int idx, const PWTS::AMD::PStateCurrentLimit &limits) const;
+        [[nodiscard]] bool hasCPPCArgs() const;
+        void setCPPCRequest(const CpuThreadView &view) const;
+        void setCoreData(PWTS::AMD::AMDCoreData &data, const int idx) const;
+        void setThreadData(PWTS::AMD::AMDThreadData &data, const int idx) const;
 
     public:
-        CliHelperAMD(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures,
+        CliHelperAMD(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures,
                         const QSharedPointer<PWTS::AMD::AMDData> &data, const QSharedPointer<UI::InputRanges> &ranges);
 
         void setClientPacketData() override;
+
+        static void appendSettingRanges(QMap<Setting, SettingBounds> &ranges, const UI::InputRanges &inputRanges);
+        static void appendSettingFeatures(QMap<Setting, SettingFeatures> &out);
     };
 }
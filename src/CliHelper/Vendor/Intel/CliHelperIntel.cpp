@@ -15,227 +15,123 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <algorithm>
+
 #include "CliHelperIntel.h"
-#include "../../../CMDParser/SettingsArguments.h"
 
 namespace PWT::CLI {
-    CliHelperIntel::CliHelperIntel(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures, const int coreCount,
+    static constexpr auto intelCpuSettings = std::make_tuple(
+        registerSetting(PWTS::Feature::INTEL_PKG_POWER_LIMIT, &PWTS::Intel::IntelData::pkgPowerLimit,
+            memberSetting(Setting::PkgLimitPl1, &PWTS::Intel::PkgPowerLimit::pl1, SettingRange::input(&UI::InputRanges::getIntelPl)),
+            memberSetting(Setting::PkgLimitPl1Time, &PWTS::Intel::PkgPowerLimit::pl1Time, SettingRange::fixed(0, 56 * 1000)),
+            memberSetting(Setting::PkgLimitPl1Clamp, &PWTS::Intel::PkgPowerLimit::pl1Clamp),
+            memberSetting(Setting::PkgLimitPl1Enable, &PWTS::Intel::PkgPowerLimit::pl1Enable),
+            memberSetting(Setting::PkgLimitPl2, &PWTS::Intel::PkgPowerLimit::pl2, SettingRange::input(&UI::InputRanges::getIntelPl)),
+            memberSetting(Setting::PkgLimitPl2Time, &PWTS::Intel::PkgPowerLimit::pl2Time, SettingRange::fixed(0, 56 * 1000)),
+            memberSetting(Setting::PkgLimitPl2Clamp, &PWTS::Intel::PkgPowerLimit::pl2Clamp),
+            memberSetting(Setting::PkgLimitPl2Enable, &PWTS::Intel::PkgPowerLimit::pl2Enable),
+            memberSetting(Setting::PkgLimitLock, &PWTS::Intel::PkgPowerLimit::lock)
+        ),
+        registerSetting(PWTS::Feature::INTEL_VR_CURRENT_CFG, &PWTS::Intel::IntelData::vrCurrentCfg,
+            memberSetting(Setting::VrCurrentCfgPl4, &PWTS::Intel::VRCurrentConfig::pl4, SettingRange::input(&UI::InputRanges::getIntelPl4)),
+            memberSetting(Setting::VrCurrentCfgLock, &PWTS::Intel::VRCurrentConfig::lock)
+        ),
+        registerSetting(PWTS::Feature::INTEL_PP1_CURRENT_CFG, &PWTS::Intel::IntelData::pp1CurrentCfg,
+            memberSetting(Setting::Pp1CurrentLimit, &PWTS::Intel::PP1CurrentConfig::limit, SettingRange::input(&UI::InputRanges::getIntelPP1)),
+            memberSetting(Setting::Pp1CurrentLock, &PWTS::Intel::PP1CurrentConfig::lock)
+        ),
+        registerSetting(PWTS::Feature::INTEL_TURBO_POWER_CURRENT_LIMIT_RW, &PWTS::Intel::IntelData::turboPowerCurrentLimit,
+            memberSetting(Setting::TurboPwrCurrentTdp, &PWTS::Intel::TurboPowerCurrentLimit::tdpLimit, SettingRange::input(&UI::InputRanges::getIntelTurboPwrCurrentTDP)),
+            memberSetting(Setting::TurboPwrCurrentTdpEnable, &PWTS::Intel::TurboPowerCurrentLimit::tdpLimitOverride),
+            memberSetting(Setting::TurboPwrCurrentTdc, &PWTS::Intel::TurboPowerCurrentLimit::tdcLimit, SettingRange::input(&UI::InputRanges::getIntelTurboPwrCurrentTDC)),
+            memberSetting(Setting::TurboPwrCurrentTdcEnable, &PWTS::Intel::TurboPowerCurrentLimit::tdcLimitOverride)
+        ),
+        fieldSetting(Setting::Pp0Priority, PWTS::Feature::INTEL_CPU_POWER_BALANCE, &PWTS::Intel::IntelData::pp0Priority, SettingRange::fixed(0, 31)),
+        fieldSetting(Setting::Pp1Priority, PWTS::Feature::INTEL_GPU_POWER_BALANCE, &PWTS::Intel::IntelData::pp1Priority, SettingRange::fixed(0, 31)),
+        registerSetting(PWTS::Feature::INTEL_IA32_MISC_ENABLE_GROUP, &PWTS::Intel::IntelData::miscProcFeatures,
+            memberSetting(Setting::EnhancedSpeedstepEnable, &PWTS::Intel::MiscProcFeatures::enhancedSpeedStep, {}, PWTS::Feature::INTEL_ENHANCED_SPEEDSTEP),
+            memberSetting(Setting::TurboModeDisable, &PWTS::Intel::MiscProcFeatures::disableTurboMode, {}, PWTS::Feature::INTEL_TURBO_BOOST)
+        ),
+        registerSetting(PWTS::Feature::INTEL_POWER_CTL, &PWTS::Intel::IntelData::powerCtl,
+            memberSetting(Setting::BdProchotEnable, &PWTS::Intel::PowerCtl::bdProcHot),
+            memberSetting(Setting::C1eEnable, &PWTS::Intel::PowerCtl::c1eEnable),
+            memberSetting(Setting::SapmImcC2Policy, &PWTS::Intel::PowerCtl::sapmImcC2Policy),
+            memberSetting(Setting::FastBrkSnpEn, &PWTS::Intel::PowerCtl::fastBrkSnpEn),
+            memberSetting(Setting::PowerPerformancePlatformOverride, &PWTS::Intel::PowerCtl::powerPerformancePlatformOverride),
+            memberSetting(Setting::EnergyEfficiencyOptDisable, &PWTS::Intel::PowerCtl::disableEnergyEfficiencyOpt),
+            memberSetting(Setting::RaceToHaltDisable, &PWTS::Intel::PowerCtl::disableRaceToHaltOpt),
+            memberSetting(Setting::ProchotOutputDisable, &PWTS::Intel::PowerCtl::prochotOutputDisable),
+            memberSetting(Setting::ProchotCfgResponseEnable, &PWTS::Intel::PowerCtl::prochotConfigurableResponseEnable),
+            memberSetting(Setting::VrThermAlertDisableLock, &PWTS::Intel::PowerCtl::vrThermAlertDisableLock),
+            memberSetting(Setting::VrThermAlertDisable, &PWTS::Intel::PowerCtl::vrThermAlertDisable),
+            memberSetting(Setting::RingEEDisable, &PWTS::Intel::PowerCtl::ringEEDisable),
+            memberSetting(Setting::SaOptDisable, &PWTS::Intel::PowerCtl::saOptimizationDisable),
+            memberSetting(Setting::OokDisable, &PWTS::Intel::PowerCtl::ookDisable),
+            memberSetting(Setting::HwpAutonomousDisable, &PWTS::Intel::PowerCtl::hwpAutonomousDisable),
+            memberSetting(Setting::CstatePrewakeDisable, &PWTS::Intel::PowerCtl::cstatePrewakeDisable)
+        ),
+        registerSetting(PWTS::Feature::INTEL_MISC_PWR_MGMT, &PWTS::Intel::IntelData::miscPwrMgmt,
+            memberSetting(Setting::EistDisable, &PWTS::Intel::MiscPwrMgmt::eistHWCoordinationDisable)
+        ),
+        registerSetting(PWTS::Feature::INTEL_UNDERVOLT_GROUP, &PWTS::Intel::IntelData::undervoltData,
+            memberSetting(Setting::UvControlCpu, &PWTS::Intel::FIVRControlUV::cpu, SettingRange::input(&UI::InputRanges::getIntelFIVR), PWTS::Feature::INTEL_UNDERVOLT_CPU),
+            memberSetting(Setting::UvControlGpu, &PWTS::Intel::FIVRControlUV::gpu, SettingRange::input(&UI::InputRanges::getIntelFIVR), PWTS::Feature::INTEL_UNDERVOLT_GPU),
+            memberSetting(Setting::UvControlCache, &PWTS::Intel::FIVRControlUV::cpuCache, SettingRange::input(&UI::InputRanges::getIntelFIVR), PWTS::Feature::INTEL_UNDERVOLT_CACHE),
+            memberSetting(Setting::UvControlUnslice, &PWTS::Intel::FIVRControlUV::unslice, SettingRange::input(&UI::InputRanges::getIntelFIVR), PWTS::Feature::INTEL_UNDERVOLT_UNSLICE),
+            memberSetting(Setting::UvControlSa, &PWTS::Intel::FIVRControlUV::sa, SettingRange::input(&UI::InputRanges::getIntelFIVR), PWTS::Feature::INTEL_UNDERVOLT_SYSAGENT)
+        )
+    );
+
+    // EPB is set through HWP EPP when available
+    static constexpr auto energyPerfBiasSetting = fieldSetting(Setting::EnergyPerfBias, PWTS::Feature::INTEL_ENERGY_PERF_BIAS, &PWTS::Intel::IntelData::energyPerfBias,
+                                                                SettingRange::fixed(0, 15));
+
+    static constexpr auto intelHwpSettings = std::make_tuple(
+        fieldSetting(Setting::HwpEnable, PWTS::Feature::INTEL_HWP_GROUP, &PWTS::Intel::IntelData::hwpEnable, {}, UnsetData::Ignore),
+        fieldSetting(Setting::HwpPkgCtlPolarityEnable, PWTS::Feature::INTEL_HWP_CTL, &PWTS::Intel::IntelData::hwpPkgCtlPolarity, {}, UnsetData::Ignore)
+    );
+
+    static constexpr auto intelMchbarSettings = std::make_tuple(
+        registerSetting(PWTS::Feature::INTEL_MCHBAR_PKG_RAPL_LIMIT, &PWTS::Intel::IntelData::mchbarPkgRaplLimit,
+            memberSetting(Setting::PkgRaplPl1, &PWTS::Intel::MCHBARPkgRaplLimit::pl1, SettingRange::input(&UI::InputRanges::getIntelPl)),
+            memberSetting(Setting::PkgRaplPl2, &PWTS::Intel::MCHBARPkgRaplLimit::pl2, SettingRange::input(&UI::InputRanges::getIntelPl)),
+            memberSetting(Setting::PkgRaplPl1Time, &PWTS::Intel::MCHBARPkgRaplLimit::pl1Time, SettingRange::fixed(0, 56 * 1000)),
+            memberSetting(Setting::PkgRaplPl1Enable, &PWTS::Intel::MCHBARPkgRaplLimit::pl1Enable),
+            memberSetting(Setting::PkgRaplPl2Enable, &PWTS::Intel::MCHBARPkgRaplLimit::pl2Enable),
+            memberSetting(Setting::PkgRaplPl1Clamp, &PWTS::Intel::MCHBARPkgRaplLimit::pl1Clamp),
+            memberSetting(Setting::PkgRaplLock, &PWTS::Intel::MCHBARPkgRaplLimit::lock)
+        )
+    );
+
+    // package c-state limit and max core c-state are checked against the cpu valid values
+    static constexpr auto pkgCstConfigControlSettings = std::make_tuple(
+        memberSetting(Setting::PkgCstCfgControlIOMWaitRedirectEnable, &PWTS::Intel::PkgCstConfigControl::ioMwaitRedirectionEnable),
+        memberSetting(Setting::PkgCstCfgControlCfgLock, &PWTS::Intel::PkgCstConfigControl::cfgLock),
+        memberSetting(Setting::PkgCstCfgControlC3StateAutodemotionEnable, &PWTS::Intel::PkgCstConfigControl::c3StateAutodemotionEnable),
+        memberSetting(Setting::PkgCstCfgControlC1StateAutodemotionEnable, &PWTS::Intel::PkgCstConfigControl::c1StateAutodemotionEnable),
+        memberSetting(Setting::PkgCstCfgControlC3UndemotionEnable, &PWTS::Intel::PkgCstConfigControl::c3UndemotionEnable),
+        memberSetting(Setting::PkgCstCfgControlC1UndemotionEnable, &PWTS::Intel::PkgCstConfigControl::c1UndemotionEnable),
+        memberSetting(Setting::PkgCstCfgControlPkgcAutodemotionEnable, &PWTS::Intel::PkgCstConfigControl::pkgcAutodemotionEnable),
+        memberSetting(Setting::PkgCstCfgControlPkgcUndemotionEnable, &PWTS::Intel::PkgCstConfigControl::pkgcUndemotionEnable),
+        memberSetting(Setting::PkgCstCfgControlTimedMwaitEnable, &PWTS::Intel::PkgCstConfigControl::timedMwaitEnable)
+    );
+
+    CliHelperIntel::CliHelperIntel(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures, const int coreCount,
                                     const QSharedPointer<PWTS::Intel::IntelData> &data, const QSharedPointer<UI::InputRanges> &ranges): CliHelper(cmd, daemonFeatures) {
         packetData = data;
         cpuCores = coreCount;
         inputRanges = ranges;
     }
 
-    void CliHelperIntel::setPkgPowerLimit() const {
-        const bool hasPl1 = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl1Arg);
-        const bool hasPl1Time = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl1TimeArg);
-        const bool hasPl1Clamp = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl1ClampArg);
-        const bool hasPl1Enable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl1EnableArg);
-        const bool hasPl2 = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl2Arg);
-        const bool hasPl2Time = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl2TimeArg);
-        const bool hasPl2Clamp = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl2ClampArg);
-        const bool hasPl2Enable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl2EnableArg);
-        const bool hasLock = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitLockArg);
-        const bool hasArgs = hasPl1 || hasPl1Time || hasPl1Clamp || hasPl1Enable || hasPl2 || hasPl2Time || hasPl2Clamp || hasPl2Enable || hasLock;
-
-        if (!hasArgs)
-            return;
-
-        if (!packetData->pkgPowerLimit.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        PWTS::Intel::PkgPowerLimit pkgLimit = packetData->pkgPowerLimit.getValue();
-        const PWTS::MinMax range = inputRanges->getIntelPl();
-
-        if (hasPl1) {
-            const int pl1 = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl1Arg).toInt();
-
-            pkgLimit.pl1 = qBound(range.min, pl1, range.max);
-        }
-
-        if (hasPl1Time) {
-            const int time = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl1TimeArg).toInt();
-            constexpr int max = 56 * 1000;
-
-            pkgLimit.pl1Time = qBound(0, time, max);
-        }
-
-        if (hasPl1Clamp)
-            pkgLimit.pl1Clamp = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl1ClampArg).toBool();
-
-        if (hasPl1Enable)
-            pkgLimit.pl1Enable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl1EnableArg).toBool();
-
-        if (hasPl2) {
-            const int pl2 = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl2Arg).toInt();
-
-            pkgLimit.pl2 = qBound(range.min, pl2, range.max);
-        }
-
-        if (hasPl2Time) {
-            const int time = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl2TimeArg).toInt();
-            constexpr int max = 56 * 1000;
-
-            pkgLimit.pl2Time = qBound(0, time, max);
-        }
-
-        if (hasPl2Clamp)
-            pkgLimit.pl2Clamp = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl2ClampArg).toBool();
-
-        if (hasPl2Enable)
-            pkgLimit.pl2Enable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitPl2EnableArg).toBool();
-
-        if (hasLock)
-            pkgLimit.lock = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgLimitLockArg).toBool();
-
-        packetData->pkgPowerLimit.setValue(pkgLimit, true);
-    }
-
-    void CliHelperIntel::setVrCurrentConfig() const {
-        const bool hasPl4 = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrCurrentCfgPl4Arg);
-        const bool hasLock = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrCurrentCfgLockArg);
-
-        if (!hasPl4 && !hasLock)
-            return;
-
-        if (!packetData->vrCurrentCfg.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        PWTS::Intel::VRCurrentConfig vrCfg = packetData->vrCurrentCfg.getValue();
-
-        if (hasPl4) {
-            const int pl4 = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrCurrentCfgPl4Arg).toInt();
-            const PWTS::MinMax range = inputRanges->getIntelPl4();
-
-            vrCfg.pl4 = qBound(range.min, pl4, range.max);
-        }
-
-        if (hasLock)
-            vrCfg.lock = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrCurrentCfgLockArg).toBool();
-
-        packetData->vrCurrentCfg.setValue(vrCfg, true);
-    }
-
-    void CliHelperIntel::setPP1() const {
-        const bool hasLimit = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pp1CurrentLimitArg);
-        const bool hasLock = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pp1CurrentLockArg);
-
-        if (!hasLimit && !hasLock)
-            return;
-
-        if (!packetData->pp1CurrentCfg.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        PWTS::Intel::PP1CurrentConfig pp1 = packetData->pp1CurrentCfg.getValue();
-
-        if (hasLimit) {
-            const int limit = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pp1CurrentLimitArg).toInt();
-            const PWTS::MinMax range = inputRanges->getIntelPP1();
-
-            pp1.limit = qBound(range.min, limit, range.max);
-        }
-
-        if (hasLock)
-            pp1.lock = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pp1CurrentLockArg).toBool();
-
-        packetData->pp1CurrentCfg.setValue(pp1, true);
-    }
-
-    void CliHelperIntel::setTurboPowerLimit() const {
-        const bool hasTdp = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboPwrCurrentTdpArg);
-        const bool hasTdpEnable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboPwrCurrentTdpEnableArg);
-        const bool hasTdc = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboPwrCurrentTdcArg);
-        const bool hasTdcEnable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboPwrCurrentTdcEnableArg);
-        const bool hasArgs = hasTdp || hasTdpEnable || hasTdc || hasTdcEnable;
-
-        if (!hasArgs)
-            return;
-
-        if (!packetData->turboPowerCurrentLimit.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        PWTS::Intel::TurboPowerCurrentLimit turboLimit = packetData->turboPowerCurrentLimit.getValue();
-
-        if (hasTdp) {
-            const int limit = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboPwrCurrentTdpArg).toInt();
-            const PWTS::MinMax range = inputRanges->getIntelTurboPwrCurrentTDP();
-
-            turboLimit.tdpLimit = qBound(range.min, limit, range.max);
-        }
-
-        if (hasTdpEnable)
-            turboLimit.tdpLimitOverride = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboPwrCurrentTdpEnableArg).toBool();
-
-        if (hasTdc) {
-            const int limit = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboPwrCurrentTdcArg).toInt();
-            const PWTS::MinMax range = inputRanges->getIntelTurboPwrCurrentTDC();
-
-            turboLimit.tdcLimit = qBound(range.min, limit, range.max);
-        }
-
-        if (hasTdcEnable)
-            turboLimit.tdcLimitOverride = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboPwrCurrentTdcEnableArg).toBool();
-
-        packetData->turboPowerCurrentLimit.setValue(turboLimit, true);
-    }
-
-    void CliHelperIntel::setCPUPowerBalance() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pp0PriorityArg))
-            return;
-
-        if (!packetData->pp0Priority.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const int pp0 = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pp0PriorityArg).toInt();
-
-        packetData->pp0Priority.setValue(qBound(0, pp0, 31), true);
-    }
-
-    void CliHelperIntel::setGPUPowerBalance() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pp1PriorityArg))
-            return;
-
-        if (!packetData->pp1Priority.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        const int pp1 = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pp1PriorityArg).toInt();
-
-        packetData->pp1Priority.setValue(qBound(0, pp1, 31), true);
-    }
-
-    void CliHelperIntel::setEnergyPerfBias() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, energyPerfBiasArg))
-            return;
-
-        if (!packetData->energyPerfBias.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        packetData->energyPerfBias.setValue(qBound(0, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, energyPerfBiasArg).toInt(), 15), true);
-    }
-
     void CliHelperIntel::setTurboRatioLimit() const {
-        const bool hasRatio1c = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit1cArg);
-        const bool hasRatio2c = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit2cArg);
-        const bool hasRatio3c = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit3cArg);
-        const bool hasRatio4c = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit4cArg);
-        const bool hasRatio5c = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit5cArg);
-        const bool hasRatio6c = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit6cArg);
-        const bool hasRatio7c = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit7cArg);
-        const bool hasRatio8c = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit8cArg);
+        const bool hasRatio1c = cmdParser->hasSetting(Setting::TurboRatioLimit1c);
+        const bool hasRatio2c = cmdParser->hasSetting(Setting::TurboRatioLimit2c);
+        const bool hasRatio3c = cmdParser->hasSetting(Setting::TurboRatioLimit3c);
+        const bool hasRatio4c = cmdParser->hasSetting(Setting::TurboRatioLimit4c);
+        const bool hasRatio5c = cmdParser->hasSetting(Setting::TurboRatioLimit5c);
+        const bool hasRatio6c = cmdParser->hasSetting(Setting::TurboRatioLimit6c);
+        const bool hasRatio7c = cmdParser->hasSetting(Setting::TurboRatioLimit7c);
+        const bool hasRatio8c = cmdParser->hasSetting(Setting::TurboRatioLimit8c);
         const bool hasArgs = hasRatio1c || hasRatio2c || hasRatio3c || hasRatio4c || hasRatio5c || hasRatio6c || hasRatio7c || hasRatio8c;
 
         if (!hasArgs)
@@ -249,226 +145,38 @@ namespace PWT::CLI {
         PWTS::Intel::TurboRatioLimit turboLimits = packetData->turboRatioLimit.getValue();
 
         if (hasRatio1c)
-            turboLimits.maxRatioLimit1C = qBound(1, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit1cArg).toInt(), 255);
+            turboLimits.maxRatioLimit1C = boundSetting(Setting::TurboRatioLimit1c, 1, cmdParser->getSetting(Setting::TurboRatioLimit1c).toInt(), 255);
 
         if (hasRatio2c && cpuCores > 1)
-            turboLimits.maxRatioLimit2C = qBound(1, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit2cArg).toInt(), 255);
+            turboLimits.maxRatioLimit2C = boundSetting(Setting::TurboRatioLimit2c, 1, cmdParser->getSetting(Setting::TurboRatioLimit2c).toInt(), 255);
 
         if (hasRatio3c && cpuCores > 2)
-            turboLimits.maxRatioLimit3C = qBound(1, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit3cArg).toInt(), 255);
+            turboLimits.maxRatioLimit3C = boundSetting(Setting::TurboRatioLimit3c, 1, cmdParser->getSetting(Setting::TurboRatioLimit3c).toInt(), 255);
 
         if (hasRatio4c && cpuCores > 3)
-            turboLimits.maxRatioLimit4C = qBound(1, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit4cArg).toInt(), 255);
+            turboLimits.maxRatioLimit4C = boundSetting(Setting::TurboRatioLimit4c, 1, cmdParser->getSetting(Setting::TurboRatioLimit4c).toInt(), 255);
 
         if (hasRatio5c && cpuCores > 4)
-            turboLimits.maxRatioLimit5C = qBound(1, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit5cArg).toInt(), 255);
+            turboLimits.maxRatioLimit5C = boundSetting(Setting::TurboRatioLimit5c, 1, cmdParser->getSetting(Setting::TurboRatioLimit5c).toInt(), 255);
 
         if (hasRatio6c && cpuCores > 5)
-            turboLimits.maxRatioLimit6C = qBound(1, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit6cArg).toInt(), 255);
+            turboLimits.maxRatioLimit6C = boundSetting(Setting::TurboRatioLimit6c, 1, cmdParser->getSetting(Setting::TurboRatioLimit6c).toInt(), 255);
 
         if (hasRatio7c && cpuCores > 6)
-            turboLimits.maxRatioLimit7C = qBound(1, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit7cArg).toInt(), 255);
+            turboLimits.maxRatioLimit7C = boundSetting(Setting::TurboRatioLimit7c, 1, cmdParser->getSetting(Setting::TurboRatioLimit7c).toInt(), 255);
 
         if (hasRatio8c && cpuCores > 7)
-            turboLimits.maxRatioLimit8C = qBound(1, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboRatioLimit8cArg).toInt(), 255);
-
-        packetData->turboRatioLimit.setValue(turboLimits, true);
-    }
-
-    void CliHelperIntel::setMiscProcFeatures() const {
-        const bool hasSpeedstep = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, enhancedSpeedstepEnableArg);
-        const bool hasTurboDisable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboModeDisableArg);
-        const bool hasArgs = hasSpeedstep || hasTurboDisable;
-
-        if (!hasArgs)
-            return;
-
-        if (!packetData->miscProcFeatures.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        PWTS::Intel::MiscProcFeatures miscFeats = packetData->miscProcFeatures.getValue();
-
-        if (hasSpeedstep && features.cpu.contains(PWTS::Feature::INTEL_ENHANCED_SPEEDSTEP))
-            miscFeats.enhancedSpeedStep = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, enhancedSpeedstepEnableArg).toBool();
-
-        if (hasTurboDisable && features.cpu.contains(PWTS::Feature::INTEL_TURBO_BOOST))
-            miscFeats.disableTurboMode = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, turboModeDisableArg).toBool();
-
-        packetData->miscProcFeatures.setValue(miscFeats, true);
-    }
-
-    void CliHelperIntel::setPowerCtl() const {
-        const bool hasBdProcHot = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, bdProchotEnableArg);
-        const bool hasC1e = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, c1eEnableArg);
-        const bool hasSapmImcC2 = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, sapmImcC2PolicyArg);
-        const bool hasFastBrkSnp = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, fastBrkSnpEnArg);
-        const bool hasPowPerfOvrd = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerPerformancePlatformOverrideArg);
-        const bool hasDisableEEO = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, energyEfficiencyOptDisableArg);
-        const bool hasDisableRto = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, raceToHaltDisableArg);
-        const bool hasProchotOutDisable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, prochotOutputDisableArg);
-        const bool hasProchotCfgRespEn = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, prochotCfgResponseEnableArg);
-        const bool hasVrThermAlertLock = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrThermAlertDisableLockArg);
-        const bool hasVrThermAlertDisable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrThermAlertDisableArg);
-        const bool hasRingEEDisable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, ringEEDisableArg);
-        const bool hasSAOptDisable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, saOptDisableArg);
-        const bool hasOOKDisable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, ookDisableArg);
-        const bool hasHwpAutoDisable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpAutonomousDisableArg);
-        const bool hasCstatePrewakeDisable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, cstatePrewakeDisableArg);
-        const bool hasArgs = hasBdProcHot || hasC1e || hasSapmImcC2 || hasFastBrkSnp || hasPowPerfOvrd ||
-                            hasDisableEEO || hasDisableRto || hasProchotOutDisable || hasProchotCfgRespEn ||
-                            hasVrThermAlertLock || hasVrThermAlertDisable || hasRingEEDisable || hasSAOptDisable ||
-                            hasOOKDisable || hasHwpAutoDisable || hasCstatePrewakeDisable;
-
-        if (!hasArgs)
-            return;
-
-        if (!packetData->powerCtl.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        PWTS::Intel::PowerCtl powCtl = packetData->powerCtl.getValue();
-
-        if (hasBdProcHot)
-            powCtl.bdProcHot = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, bdProchotEnableArg).toBool();
-
-        if (hasC1e)
-            powCtl.c1eEnable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, c1eEnableArg).toBool();
-
-        if (hasSapmImcC2)
-            powCtl.sapmImcC2Policy = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, sapmImcC2PolicyArg).toBool();
-
-        if (hasFastBrkSnp)
-            powCtl.fastBrkSnpEn = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, fastBrkSnpEnArg).toBool();
-
-        if (hasPowPerfOvrd)
-            powCtl.powerPerformancePlatformOverride = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, powerPerformancePlatformOverrideArg).toBool();
-
-        if (hasDisableEEO)
-            powCtl.disableEnergyEfficiencyOpt = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, energyEfficiencyOptDisableArg).toBool();
-
-        if (hasDisableRto)
-            powCtl.disableRaceToHaltOpt = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, raceToHaltDisableArg).toBool();
-
-        if (hasProchotOutDisable)
-            powCtl.prochotOutputDisable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, prochotOutputDisableArg).toBool();
-
-        if (hasProchotCfgRespEn)
-            powCtl.prochotConfigurableResponseEnable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, prochotCfgResponseEnableArg).toBool();
-
-        if (hasVrThermAlertLock)
-            powCtl.vrThermAlertDisableLock = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrThermAlertDisableLockArg).toBool();
-
-        if (hasVrThermAlertDisable)
-            powCtl.vrThermAlertDisable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, vrThermAlertDisableArg).toBool();
-
-        if (hasRingEEDisable)
-            powCtl.ringEEDisable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, ringEEDisableArg).toBool();
-
-        if (hasSAOptDisable)
-            powCtl.saOptimizationDisable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, saOptDisableArg).toBool();
-
-        if (hasOOKDisable)
-            powCtl.ookDisable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, ookDisableArg).toBool();
-
-        if (hasHwpAutoDisable)
-            powCtl.hwpAutonomousDisable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpAutonomousDisableArg).toBool();
-
-        if (hasCstatePrewakeDisable)
-            powCtl.cstatePrewakeDisable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, cstatePrewakeDisableArg).toBool();
+            turboLimits.maxRatioLimit8C = boundSetting(Setting::TurboRatioLimit8c, 1, cmdParser->getSetting(Setting::TurboRatioLimit8c).toInt(), 255);
 
-        packetData->powerCtl.setValue(powCtl, true);
-    }
-
-    void CliHelperIntel::setMiscPowerMgmt() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, eistDisableArg))
-            return;
-
-        if (!packetData->miscPwrMgmt.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        PWTS::Intel::MiscPwrMgmt miscPwr = packetData->miscPwrMgmt.getValue();
-
-        miscPwr.eistHWCoordinationDisable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, eistDisableArg).toBool();
-
-        packetData->miscPwrMgmt.setValue(miscPwr, true);
-    }
-
-    void CliHelperIntel::setFivr() const {
-        const bool hasCpuUv = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlCpuArg);
-        const bool hasGpuUv = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlGpuArg);
-        const bool hasCacheUv = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlCacheArg);
-        const bool hasUnsliceUv = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlUnsliceArg);
-        const bool hasSaUv = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlSaArg);
-        const bool hasArgs = hasCpuUv || hasGpuUv || hasCacheUv || hasUnsliceUv || hasSaUv;
-
-        if (!hasArgs)
-            return;
-
-        if (!packetData->undervoltData.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        PWTS::Intel::FIVRControlUV fivr = packetData->undervoltData.getValue();
-        const PWTS::MinMax range = inputRanges->getIntelFIVR();
-
-        if (hasCpuUv && features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_CPU))
-            fivr.cpu = qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlCpuArg).toInt(), range.max);
-
-        if (hasGpuUv && features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_GPU))
-            fivr.gpu = qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlGpuArg).toInt(), range.max);
-
-        if (hasCacheUv && features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_CACHE))
-            fivr.cpuCache = qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlCacheArg).toInt(), range.max);
-
-        if (hasUnsliceUv && features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_UNSLICE))
-            fivr.unslice = qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlUnsliceArg).toInt(), range.max);
-
-        if (hasSaUv && features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_SYSAGENT))
-            fivr.sa = qBound(range.min, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, uvControlSaArg).toInt(), range.max);
-
-        packetData->undervoltData.setValue(fivr, true);
-    }
-
-    void CliHelperIntel::setHwpEnable() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpEnableArg)) {
-            packetData->hwpEnable.setIgnored(true);
-            return;
-        }
-
-        if (!packetData->hwpEnable.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        packetData->hwpEnable.setValue(cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpEnableArg).toBool(), true);
-    }
-
-    void CliHelperIntel::setHwpPkgCtlPolarityEnable() const {
-        if (!cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpPkgCtlPolarityEnableArg)) {
-            packetData->hwpPkgCtlPolarity.setIgnored(true);
-            return;
-        }
-
-        if (!packetData->hwpPkgCtlPolarity.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        packetData->hwpPkgCtlPolarity.setValue(cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpPkgCtlPolarityEnableArg).toBool(), true);
+        setData(packetData->turboRatioLimit, turboLimits);
     }
 
     void CliHelperIntel::setHwpRequestPkg() const {
-        const bool hasMin = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgMinPerfArg);
-        const bool hasMax = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgMaxPerfArg);
-        const bool hasDesired = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgDesiredPerfArg);
-        const bool hasEpp = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgEppArg);
-        const bool hasAcw = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgAcwArg);
+        const bool hasMin = cmdParser->hasSetting(Setting::HwpRequestPkgMinPerf);
+        const bool hasMax = cmdParser->hasSetting(Setting::HwpRequestPkgMaxPerf);
+        const bool hasDesired = cmdParser->hasSetting(Setting::HwpRequestPkgDesiredPerf);
+        const bool hasEpp = cmdParser->hasSetting(Setting::HwpRequestPkgEpp);
+        const bool hasAcw = cmdParser->hasSetting(Setting::HwpRequestPkgAcw);
         const bool hasArgs = hasMin || hasMax || hasDesired || hasEpp || hasAcw;
 
         if (!hasArgs) {
@@ -503,441 +211,352 @@ namespace PWT::CLI {
         }
 
         if (hasMin)
-            req.min = qBound(pkgCaps.lowestPerf, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgMinPerfArg).toInt(), pkgCaps.highestPerf);
+            req.min = boundSetting(Setting::HwpRequestPkgMinPerf, pkgCaps.lowestPerf, cmdParser->getSetting(Setting::HwpRequestPkgMinPerf).toInt(), pkgCaps.highestPerf);
 
         if (hasMax)
-            req.max = qBound(pkgCaps.lowestPerf, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgMaxPerfArg).toInt(), pkgCaps.highestPerf);
+            req.max = boundSetting(Setting::HwpRequestPkgMaxPerf, pkgCaps.lowestPerf, cmdParser->getSetting(Setting::HwpRequestPkgMaxPerf).toInt(), pkgCaps.highestPerf);
 
         if (hasDesired)
-            req.desired = qBound(pkgCaps.lowestPerf, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgDesiredPerfArg).toInt(), pkgCaps.highestPerf);
+            req.desired = boundSetting(Setting::HwpRequestPkgDesiredPerf, pkgCaps.lowestPerf, cmdParser->getSetting(Setting::HwpRequestPkgDesiredPerf).toInt(), pkgCaps.highestPerf);
 
-        if (hasEpp && features.cpu.contains(PWTS::Feature::INTEL_HWP_EPP))
-            req.epp = qBound(0, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgEppArg).toInt(), 255);
+        if (hasEpp && features.cpu(PWTS::Feature::INTEL_HWP_EPP))
+            req.epp = boundSetting(Setting::HwpRequestPkgEpp, 0, cmdParser->getSetting(Setting::HwpRequestPkgEpp).toInt(), 255);
 
-        if (hasAcw && features.cpu.contains(PWTS::Feature::INTEL_HWP_ACT_WIND))
-            req.acw = qBound(0, cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgAcwArg).toInt(), 127 * 1000);
+        if (hasAcw && features.cpu(PWTS::Feature::INTEL_HWP_ACT_WIND))
+            req.acw = boundSetting(Setting::HwpRequestPkgAcw, 0, cmdParser->getSetting(Setting::HwpRequestPkgAcw).toInt(), 127 * 1000);
 
-        packetData->hwpRequestPkg.setValue(req, true);
+        setData(packetData->hwpRequestPkg, req);
     }
 
-    void CliHelperIntel::setHwpRequest(PWTS::Intel::IntelThreadData &data, const QString &argIdx) const {
-        const bool hasMin = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestMinPerfArg);
-        const bool hasMax = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestMaxPerfArg);
-        const bool hasDesired = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestDesiredPerfArg);
-        const bool hasEpp = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestEppArg);
-        const bool hasAcw = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestAcwArg);
-        const bool hasPkgControl = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgControlArg);
-        const bool hasMinValid = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestMinValidArg);
-        const bool hasMaxValid = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestMaxValidArg);
-        const bool hasDesiredValid = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestDesiredValidArg);
-        const bool hasEppValid = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestEppValidArg);
-        const bool hasAcwValid = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestAcwValidArg);
-        const bool hasArgs = hasMin || hasMax || hasDesired || hasEpp || hasAcw || hasPkgControl || hasMinValid ||
-                            hasMaxValid || hasDesiredValid || hasEppValid || hasAcwValid;
+    bool CliHelperIntel::hasHwpRequestArgs() const {
+        static constexpr std::array hwpSettings = {
+            Setting::HwpRequestMinPerf, Setting::HwpRequestMaxPerf, Setting::HwpRequestDesiredPerf, Setting::HwpRequestEpp,
+            Setting::HwpRequestAcw, Setting::HwpRequestPkgControl, Setting::HwpRequestMinValid, Setting::HwpRequestMaxValid,
+            Setting::HwpRequestDesiredValid, Setting::HwpRequestEppValid, Setting::HwpRequestAcwValid
+        };
 
-        if (!hasArgs) {
-            data.hwpRequest.setIgnored(true);
-            return;
-        }
+        return std::ranges::any_of(hwpSettings, [this](const Setting setting) { return cmdParser->hasSetting(setting); });
+    }
 
-        if (!data.hwpCapapabilities.isValid() || !data.hwpRequest.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
-            return;
+    QList<std::optional<PWTS::Intel::HWPRequest>> CliHelperIntel::getHwpRequests(const CpuThreadView &view) const {
+        const bool hasMin = cmdParser->hasSetting(Setting::HwpRequestMinPerf);
+        const bool hasMax = cmdParser->hasSetting(Setting::HwpRequestMaxPerf);
+        const bool hasDesired = cmdParser->hasSetting(Setting::HwpRequestDesiredPerf);
+        const bool hasEpp = cmdParser->hasSetting(Setting::HwpRequestEpp);
+        const bool hasAcw = cmdParser->hasSetting(Setting::HwpRequestAcw);
+        const bool hasPkgControl = cmdParser->hasSetting(Setting::HwpRequestPkgControl);
+        const bool hasEppFeature = features.cpu(PWTS::Feature::INTEL_HWP_EPP);
+        const bool hasAcwFeature = features.cpu(PWTS::Feature::INTEL_HWP_ACT_WIND);
+        const bool hasPkgFeature = features.cpu(PWTS::Feature::INTEL_HWP_REQ_PKG);
+        QList<std::optional<PWTS::Intel::HWPRequest>> requests(packetData->threadData.size());
+
+        if (!hasHwpRequestArgs()) {
+            for (PWTS::Intel::IntelThreadData &thd: packetData->threadData)
+                thd.hwpRequest.setIgnored(true);
+
+            return requests;
         }
 
-        const PWTS::Intel::HWPCapabilities caps = data.hwpCapapabilities.getValue();
-        PWTS::Intel::HWPRequest req = data.hwpRequest.getValue();
+        const int count = static_cast<int>(view.count);
+        QList<bool> valid(count);
 
-        if (hasMin) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestMinPerfArg).toHash();
+        for (int i=0; i<count; ++i)
+            valid[i] = view.hwpMin.valid[i] && view.hwpLowest.valid[i];
 
-            if (args.contains("all"))
-                req.requestPkg.min = qBound(caps.lowestPerf, args["all"].toInt(), caps.highestPerf);
-            else if (args.contains(argIdx))
-                req.requestPkg.min = qBound(caps.lowestPerf, args[argIdx].toInt(), caps.highestPerf);
-        }
+        const QList<int> minPerf = boundColumn(Setting::HwpRequestMinPerf, view.hwpMin.values, valid, view.hwpLowest.values, view.hwpHighest.values);
+        const QList<int> maxPerf = boundColumn(Setting::HwpRequestMaxPerf, view.hwpMax.values, valid, view.hwpLowest.values, view.hwpHighest.values);
+        const QList<int> desired = boundColumn(Setting::HwpRequestDesiredPerf, view.hwpDesired.values, valid, view.hwpLowest.values, view.hwpHighest.values);
+        const QList<int> epp = hasEppFeature ? boundColumn(Setting::HwpRequestEpp, view.hwpEpp.values, valid, QList<int>(count, 0), QList<int>(count, 255)) : view.hwpEpp.values;
+        const QList<int> acw = hasAcwFeature ? boundColumn(Setting::HwpRequestAcw, view.hwpAcw.values, valid, QList<int>(count, 0), QList<int>(count, 127 * 1000)) : view.hwpAcw.values;
 
-        if (hasMax) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestMaxPerfArg).toHash();
+        // per-cpu values must apply, a previous collapse may have left package control on
+        const bool resetPkgControl = !hasPkgControl && hasPkgFeature && (hasMin || hasMax || hasDesired || hasEpp || hasAcw);
+        const bool pkgCtlPolarity = packetData->hwpPkgCtlPolarity.isValid() && packetData->hwpPkgCtlPolarity.getValue();
 
-            if (args.contains("all"))
-                req.requestPkg.max = qBound(caps.lowestPerf, args["all"].toInt(), caps.highestPerf);
-            else if (args.contains(argIdx))
-                req.requestPkg.max = qBound(caps.lowestPerf, args[argIdx].toInt(), caps.highestPerf);
-        }
+        for (int i=0; i<count; ++i) {
+            if (!valid[i]) {
+                logger->write(QString("invalid data in packet for cpu %1").arg(i));
+                continue;
+            }
 
-        if (hasDesired) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestDesiredPerfArg).toHash();
+            PWTS::Intel::HWPRequest req = packetData->threadData[i].hwpRequest.getValue();
+            const auto setBit = [this, i](bool &bit, const Setting setting, const bool enabled) {
+                if (!enabled || !cmdParser->hasSetting(setting))
+                    return;
+
+                if (const std::optional<bool> value = cmdParser->getSetting(setting).boolAt(i))
+                    bit = *value;
+            };
+
+            req.requestPkg.min = minPerf[i];
+            req.requestPkg.max = maxPerf[i];
+            req.requestPkg.desired = desired[i];
+            req.requestPkg.epp = epp[i];
+            req.requestPkg.acw = acw[i];
+
+            if (resetPkgControl)
+                req.packageControl = pkgCtlPolarity;
+            else
+                setBit(req.packageControl, Setting::HwpRequestPkgControl, hasPkgFeature);
+
+            if (features.cpu(PWTS::Feature::INTEL_HWP_VALID_BITS)) {
+                setBit(req.minValid, Setting::HwpRequestMinValid, true);
+                setBit(req.maxValid, Setting::HwpRequestMaxValid, true);
+                setBit(req.desiredValid, Setting::HwpRequestDesiredValid, true);
+                setBit(req.eppValid, Setting::HwpRequestEppValid, hasEppFeature);
+                setBit(req.acwValid, Setting::HwpRequestAcwValid, hasAcwFeature);
+            }
 
-            if (args.contains("all"))
-                req.requestPkg.desired = qBound(caps.lowestPerf, args["all"].toInt(), caps.highestPerf);
-            else if (args.contains(argIdx))
-                req.requestPkg.desired = qBound(caps.lowestPerf, args[argIdx].toInt(), caps.highestPerf);
+            requests[i] = req;
         }
 
-        if (hasEpp && features.cpu.contains(PWTS::Feature::INTEL_HWP_EPP)) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestEppArg).toHash();
+        return requests;
+    }
 
-            if (args.contains("all"))
-                req.requestPkg.epp = qBound(0, args["all"].toInt(), 255);
-            else if (args.contains(argIdx))
-                req.requestPkg.epp = qBound(0, args[argIdx].toInt(), 255);
-        }
+    bool CliHelperIntel::collapseHwpRequest(const QList<std::optional<PWTS::Intel::HWPRequest>> &requests) const {
+        static constexpr std::array pkgSettings = {
+            Setting::HwpRequestPkgMinPerf, Setting::HwpRequestPkgMaxPerf, Setting::HwpRequestPkgDesiredPerf, Setting::HwpRequestPkgEpp,
+            Setting::HwpRequestPkgAcw, Setting::HwpRequestPkgControl, Setting::HwpRequestMinValid, Setting::HwpRequestMaxValid,
+            Setting::HwpRequestDesiredValid, Setting::HwpRequestEppValid, Setting::HwpRequestAcwValid
+        };
+        static constexpr std::array threadSettings = {
+            Setting::HwpRequestMinPerf, Setting::HwpRequestMaxPerf, Setting::HwpRequestDesiredPerf, Setting::HwpRequestEpp, Setting::HwpRequestAcw
+        };
+        const auto hasSetting = [this](const Setting setting) { return cmdParser->hasSetting(setting); };
 
-        if (hasAcw && features.cpu.contains(PWTS::Feature::INTEL_HWP_ACT_WIND)) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestAcwArg).toHash();
+        // explicit package or valid bits requests are sent as they are
+        if (!diffApply || requests.isEmpty() || !requests.first() || !features.cpu(PWTS::Feature::INTEL_HWP_REQ_PKG) ||
+            !packetData->hwpRequestPkg.isValid() || std::ranges::any_of(pkgSettings, hasSetting))
+            return false;
 
-            if (args.contains("all"))
-                req.requestPkg.acw = qBound(0, args["all"].toInt(), 127 * 1000);
-            else if (args.contains(argIdx))
-                req.requestPkg.acw = qBound(0, args[argIdx].toInt(), 127 * 1000);
-        }
+        // inverted polarity, threads with package control set do not follow the package request
+        if (packetData->hwpPkgCtlPolarity.isValid() && packetData->hwpPkgCtlPolarity.getValue())
+            return false;
 
-        if (hasPkgControl && features.cpu.contains(PWTS::Feature::INTEL_HWP_REQ_PKG)) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestPkgControlArg).toHash();
+        const PWTS::Intel::HWPRequest &first = *requests.first();
+        int threadWrites = 0;
+        int pkgWrites = 0;
 
-            if (args.contains("all"))
-                req.packageControl = args["all"].toBool();
-            else if (args.contains(argIdx))
-                req.packageControl = args[argIdx].toBool();
-        }
+        for (int i = 0; i < requests.size(); ++i) {
+            const std::optional<PWTS::Intel::HWPRequest> &req = requests[i];
 
-        if (features.cpu.contains(PWTS::Feature::INTEL_HWP_VALID_BITS)) {
-            if (hasMinValid) {
-                const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestMinValidArg).toHash();
+            if (!req || req->minValid || req->maxValid || req->desiredValid || req->eppValid || req->acwValid)
+                return false;
 
-                if (args.contains("all"))
-                    req.minValid = args["all"].toBool();
-                else if (args.contains(argIdx))
-                    req.minValid = args[argIdx].toBool();
-            }
+            if (req->requestPkg.min != first.requestPkg.min || req->requestPkg.max != first.requestPkg.max ||
+                req->requestPkg.desired != first.requestPkg.desired || req->requestPkg.epp != first.requestPkg.epp ||
+                req->requestPkg.acw != first.requestPkg.acw)
+                return false;
 
-            if (hasMaxValid) {
-                const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestMaxValidArg).toHash();
+            const PWTS::Intel::HWPRequest current = packetData->threadData[i].hwpRequest.getValue();
 
-                if (args.contains("all"))
-                    req.maxValid = args["all"].toBool();
-                else if (args.contains(argIdx))
-                    req.maxValid = args[argIdx].toBool();
-            }
+            if (!isSameValue(current, *req))
+                ++threadWrites;
 
-            if (hasDesiredValid) {
-                const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestDesiredValidArg).toHash();
+            if (!current.packageControl)
+                ++pkgWrites;
+        }
 
-                if (args.contains("all"))
-                    req.desiredValid = args["all"].toBool();
-                else if (args.contains(argIdx))
-                    req.desiredValid = args[argIdx].toBool();
-            }
+        PWTS::Intel::HWPRequestPkg pkgReq = packetData->hwpRequestPkg.getValue();
 
-            if (hasEppValid && features.cpu.contains(PWTS::Feature::INTEL_HWP_EPP)) {
-                const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestEppValidArg).toHash();
+        pkgReq.min = first.requestPkg.min;
+        pkgReq.max = first.requestPkg.max;
+        pkgReq.desired = first.requestPkg.desired;
+        pkgReq.epp = first.requestPkg.epp;
+        pkgReq.acw = first.requestPkg.acw;
 
-                if (args.contains("all"))
-                    req.eppValid = args["all"].toBool();
-                else if (args.contains(argIdx))
-                    req.eppValid = args[argIdx].toBool();
-            }
+        if (!isSameValue(packetData->hwpRequestPkg.getValue(), pkgReq))
+            ++pkgWrites;
 
-            if (hasAcwValid && features.cpu.contains(PWTS::Feature::INTEL_HWP_ACT_WIND)) {
-                const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, hwpRequestAcwValidArg).toHash();
+        if (pkgWrites >= threadWrites)
+            return false;
 
-                if (args.contains("all"))
-                    req.acwValid = args["all"].toBool();
-                else if (args.contains(argIdx))
-                    req.acwValid = args[argIdx].toBool();
-            }
+        // package control stays on, until per-cpu values are set again
+        for (PWTS::Intel::IntelThreadData &thd: packetData->threadData) {
+            PWTS::Intel::HWPRequest req = thd.hwpRequest.getValue();
+
+            req.packageControl = true;
+            setData(thd.hwpRequest, req);
         }
 
-        data.hwpRequest.setValue(req, true);
+        setData(packetData->hwpRequestPkg, pkgReq);
+
+        for (const Setting setting: threadSettings) {
+            if (hasSetting(setting))
+                collapsed.append(setting);
+        }
+
+        logger->write(QString("hwp request: same value for all %1 cpus, sent as package request, package control enabled on all cpus").arg(requests.size()));
+        return true;
+    }
+
+    void CliHelperIntel::setHwpRequest(const QList<std::optional<PWTS::Intel::HWPRequest>> &requests) const {
+        if (collapseHwpRequest(requests))
+            return;
+
+        PWTS::Intel::IntelThreadData *threadData = packetData->threadData.data();
+        const std::optional<PWTS::Intel::HWPRequest> *request = requests.data();
+
+        forEachIndex(requests.size(), [this, threadData, request](const int i) {
+            if (request[i])
+                setData(threadData[i].hwpRequest, *request[i]);
+        });
     }
 
-    void CliHelperIntel::setPkgCstConfigControl(PWTS::Intel::IntelCoreData &data, const QString &argIdx) const {
-        const bool hasCStateLimit = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlCstateLimArg);
-        const bool hasMaxCoreCstate = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlMaxCoreCstateArg);
-        const bool hasIoMWaitRedirect = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlIOMWaitRedirectEnableArg);
-        const bool hasCfgLock = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlCfgLockArg);
-        const bool hasC3AutoDemotion = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlC3StateAutodemotionEnableArg);
-        const bool hasC1AutoDemotion = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlC1StateAutodemotionEnableArg);
-        const bool hasC3Undemotion = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlC3UndemotionEnableArg);
-        const bool hasC1Undemotion = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlC1UndemotionEnableArg);
-        const bool hasPkgcAutodemotion = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlPkgcAutodemotionEnableArg);
-        const bool hasPkgcUndemotion = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlPkgcUndemotionEnableArg);
-        const bool hasTimedMwait = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlTimedMwaitEnableArg);
-        const bool hasArgs = hasCStateLimit || hasMaxCoreCstate || hasIoMWaitRedirect || hasCfgLock || hasC3AutoDemotion ||
-                            hasC1AutoDemotion || hasC3Undemotion || hasC1Undemotion || hasPkgcAutodemotion || hasPkgcUndemotion ||
-                            hasTimedMwait;
+    void CliHelperIntel::setPkgCstConfigControl(PWTS::Intel::IntelCoreData &data, const int idx) const {
+        const bool hasCStateLimit = cmdParser->hasSetting(Setting::PkgCstCfgControlCstateLim);
+        const bool hasMaxCoreCstate = cmdParser->hasSetting(Setting::PkgCstCfgControlMaxCoreCstate);
+        const bool hasArgs = hasCStateLimit || hasMaxCoreCstate || hasAnySetting(pkgCstConfigControlSettings);
 
         if (!hasArgs)
             return;
 
         if (!data.pkgCstConfigControl.isValid()) {
-            logger->write(QString("invalid data in packet for cpu %1").arg(argIdx));
+            logger->write(QString("invalid data in packet for cpu %1").arg(idx));
             return;
         }
 
         PWTS::Intel::PkgCstConfigControl pkgCstConfig = data.pkgCstConfigControl.getValue();
 
         if (hasCStateLimit) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlCstateLimArg).toHash();
+            const std::optional<int> value = cmdParser->getSetting(Setting::PkgCstCfgControlCstateLim).intAt(idx);
             QList<int> validList;
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_SB))
+            if (features.cpu(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_SB))
                 validList.append({0,1,2,3,4,5,7});
-            else if (features.cpu.contains(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_CU1))
+            else if (features.cpu(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_CU1))
                 validList.append({0,1,2,3,4,5,6,7,8});
 
-            if (args.contains("all"))
-                pkgCstConfig.packageCStateLimit = args["all"].toInt();
-            else if (args.contains(argIdx))
-                pkgCstConfig.packageCStateLimit = args[argIdx].toInt();
+            if (value)
+                pkgCstConfig.packageCStateLimit = *value;
 
             if (!validList.contains(pkgCstConfig.packageCStateLimit)) {
-                logInvalidValue(pkgCstCfgControlCstateLimArg, QString::number(pkgCstConfig.packageCStateLimit));
+                logInvalidValue(Setting::PkgCstCfgControlCstateLim, QString::number(pkgCstConfig.packageCStateLimit));
                 return;
             }
         }
 
         if (hasMaxCoreCstate) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlMaxCoreCstateArg).toHash();
+            const std::optional<int> value = cmdParser->getSetting(Setting::PkgCstCfgControlMaxCoreCstate).intAt(idx);
             QList<int> validList;
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_CU1))
+            if (features.cpu(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_CU1))
                 validList.append({1,2,3});
 
-            if (args.contains("all"))
-                pkgCstConfig.maxCoreCState = args["all"].toInt();
-            else if (args.contains(argIdx))
-                pkgCstConfig.maxCoreCState = args[argIdx].toInt();
+            if (value)
+                pkgCstConfig.maxCoreCState = *value;
 
             if (!validList.contains(pkgCstConfig.maxCoreCState)) {
-                logInvalidValue(pkgCstCfgControlMaxCoreCstateArg, QString::number(pkgCstConfig.maxCoreCState));
+                logInvalidValue(Setting::PkgCstCfgControlMaxCoreCstate, QString::number(pkgCstConfig.maxCoreCState));
                 return;
             }
         }
 
-        if (hasIoMWaitRedirect) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlIOMWaitRedirectEnableArg).toHash();
-
-            if (args.contains("all"))
-                pkgCstConfig.ioMwaitRedirectionEnable = args["all"].toBool();
-            else if (args.contains(argIdx))
-                pkgCstConfig.ioMwaitRedirectionEnable = args[argIdx].toBool();
-        }
-
-        if (hasCfgLock) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlCfgLockArg).toHash();
-
-            if (args.contains("all"))
-                pkgCstConfig.cfgLock = args["all"].toBool();
-            else if (args.contains(argIdx))
-                pkgCstConfig.cfgLock = args[argIdx].toBool();
-        }
-
-        if (hasC3AutoDemotion) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlC3StateAutodemotionEnableArg).toHash();
-
-            if (args.contains("all"))
-                pkgCstConfig.c3StateAutodemotionEnable = args["all"].toBool();
-            else if (args.contains(argIdx))
-                pkgCstConfig.c3StateAutodemotionEnable = args[argIdx].toBool();
-        }
-
-        if (hasC1AutoDemotion) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlC1StateAutodemotionEnableArg).toHash();
-
-            if (args.contains("all"))
-                pkgCstConfig.c1StateAutodemotionEnable = args["all"].toBool();
-            else if (args.contains(argIdx))
-                pkgCstConfig.c1StateAutodemotionEnable = args[argIdx].toBool();
-        }
-
-        if (hasC3Undemotion) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlC3UndemotionEnableArg).toHash();
-
-            if (args.contains("all"))
-                pkgCstConfig.c3UndemotionEnable = args["all"].toBool();
-            else if (args.contains(argIdx))
-                pkgCstConfig.c3UndemotionEnable = args[argIdx].toBool();
-        }
-
-        if (hasC1Undemotion) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlC1UndemotionEnableArg).toHash();
-
-            if (args.contains("all"))
-                pkgCstConfig.c1UndemotionEnable = args["all"].toBool();
-            else if (args.contains(argIdx))
-                pkgCstConfig.c1UndemotionEnable = args[argIdx].toBool();
-        }
-
-        if (hasPkgcAutodemotion) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlPkgcAutodemotionEnableArg).toHash();
-
-            if (args.contains("all"))
-                pkgCstConfig.pkgcAutodemotionEnable = args["all"].toBool();
-            else if (args.contains(argIdx))
-                pkgCstConfig.pkgcAutodemotionEnable = args[argIdx].toBool();
-        }
-
-        if (hasPkgcUndemotion) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlPkgcUndemotionEnableArg).toHash();
-
-            if (args.contains("all"))
-                pkgCstConfig.pkgcUndemotionEnable = args["all"].toBool();
-            else if (args.contains(argIdx))
-                pkgCstConfig.pkgcUndemotionEnable = args[argIdx].toBool();
-        }
-
-        if (hasTimedMwait) {
-            const QHash<QString, QVariant> args = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgCstCfgControlTimedMwaitEnableArg).toHash();
-
-            if (args.contains("all"))
-                pkgCstConfig.timedMwaitEnable = args["all"].toBool();
-            else if (args.contains(argIdx))
-                pkgCstConfig.timedMwaitEnable = args[argIdx].toBool();
-        }
-
-        data.pkgCstConfigControl.setValue(pkgCstConfig, true);
+        setMembers(pkgCstConfig, pkgCstConfigControlSettings, idx);
+        setData(data.pkgCstConfigControl, pkgCstConfig);
     }
 
-    void CliHelperIntel::setMCHBARPkgRaplLimit() const {
-        const bool hasPl1 = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl1Arg);
-        const bool hasPl2 = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl2Arg);
-        const bool hasPl1Enable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl1EnableArg);
-        const bool hasPl2Enable = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl2EnableArg);
-        const bool hasPl1Clamp = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl1ClampArg);
-        const bool hasPl1Time = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl1TimeArg);
-        const bool hasLock = cmdParser->hasCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplLockArg);
-        const bool hasArgs = hasPl1 || hasPl2 || hasPl1Enable || hasPl2Enable || hasPl1Clamp ||
-                            hasPl1Time || hasLock;
-
-        if (!hasArgs)
-            return;
-
-        if (!packetData->mchbarPkgRaplLimit.isValid()) {
-            logger->write(QStringLiteral("invalid data in packet"));
-            return;
-        }
-
-        PWTS::Intel::MCHBARPkgRaplLimit rapl = packetData->mchbarPkgRaplLimit.getValue();
-        const PWTS::MinMax range = inputRanges->getIntelPl();
-
-        if (hasPl1) {
-            const int pl1 = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl1Arg).toInt();
-
-            rapl.pl1 = qBound(range.min, pl1, range.max);
-        }
-
-        if (hasPl2) {
-            const int pl2 = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl2Arg).toInt();
-
-            rapl.pl1 = qBound(range.min, pl2, range.max);
-        }
-
-        if (hasPl1Time) {
-            const int time = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl1TimeArg).toInt();
-            constexpr int max = 56 * 1000;
-
-            rapl.pl1Time = qBound(0, time, max);
+    void CliHelperIntel::setCoreData(PWTS::Intel::IntelCoreData &data, const int idx) const {
+        if (features.cpu(PWTS::Feature::INTEL_CPU_GROUP)) {
+            if (features.cpu(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL)) {
+                setPkgCstConfigControl(data, idx);
+            }
         }
-
-        if (hasPl1Enable)
-            rapl.pl1Enable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl1EnableArg).toBool();
-
-        if (hasPl2Enable)
-            rapl.pl2Enable = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl2EnableArg).toBool();
-
-        if (hasPl1Clamp)
-            rapl.pl1Clamp = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplPl1ClampArg).toBool();
-
-        if (hasLock)
-            rapl.lock = cmdParser->getCmdValue(CMDArg::SET_DEVICE_SETTINGS, pkgRaplLockArg).toBool();
-
-        packetData->mchbarPkgRaplLimit.setValue(rapl, true);
     }
 
-    void CliHelperIntel::setCoreData(PWTS::Intel::IntelCoreData &data, const QString &argIdx) const {
-        if (features.cpu.contains(PWTS::Feature::INTEL_CPU_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL)) {
-                setPkgCstConfigControl(data, argIdx);
-            }
-        }
+    void CliHelperIntel::appendSettingRanges(QMap<Setting, SettingBounds> &ranges, const UI::InputRanges &inputRanges) {
+        appendRanges(ranges, intelCpuSettings, inputRanges);
+        appendRanges(ranges, energyPerfBiasSetting, inputRanges);
+        appendRanges(ranges, intelHwpSettings, inputRanges);
+        appendRanges(ranges, intelMchbarSettings, inputRanges);
+        appendRanges(ranges, pkgCstConfigControlSettings, inputRanges);
     }
 
-    void CliHelperIntel::setThreadData(PWTS::Intel::IntelThreadData &data, const QString &argIdx) const {
-        if (features.cpu.contains(PWTS::Feature::INTEL_CPU_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::INTEL_HWP_GROUP))
-                setHwpRequest(data, argIdx);
-        }
+    void CliHelperIntel::appendSettingFeatures(QMap<Setting, SettingFeatures> &out) {
+        appendFeatures(out, intelCpuSettings, PWTS::Feature::INTEL_CPU_GROUP);
+        appendFeatures(out, energyPerfBiasSetting, PWTS::Feature::INTEL_CPU_GROUP);
+        appendFeatures(out, intelHwpSettings, PWTS::Feature::INTEL_HWP_GROUP);
+        appendFeatures(out, intelMchbarSettings, PWTS::Feature::INTEL_MCHBAR_GROUP);
+        appendFeatures(out, pkgCstConfigControlSettings, PWTS::Feature::INTEL_CPU_GROUP, PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL);
+
+        // set by hand, see setTurboRatioLimit, setHwpRequestPkg, getHwpRequests and setPkgCstConfigControl
+        for (const Setting setting: {Setting::TurboRatioLimit1c, Setting::TurboRatioLimit2c, Setting::TurboRatioLimit3c, Setting::TurboRatioLimit4c,
+                                    Setting::TurboRatioLimit5c, Setting::TurboRatioLimit6c, Setting::TurboRatioLimit7c, Setting::TurboRatioLimit8c})
+            appendFeatures(out, setting, PWTS::Feature::INTEL_CPU_GROUP, PWTS::Feature::INTEL_TURBO_RATIO_LIMIT_RW);
+
+        for (const Setting setting: {Setting::HwpRequestPkgMinPerf, Setting::HwpRequestPkgMaxPerf, Setting::HwpRequestPkgDesiredPerf})
+            appendFeatures(out, setting, PWTS::Feature::INTEL_HWP_GROUP, PWTS::Feature::INTEL_HWP_REQ_PKG);
+
+        for (const Setting setting: {Setting::HwpRequestMinPerf, Setting::HwpRequestMaxPerf, Setting::HwpRequestDesiredPerf})
+            appendFeatures(out, setting, PWTS::Feature::INTEL_CPU_GROUP, PWTS::Feature::INTEL_HWP_GROUP);
+
+        for (const Setting setting: {Setting::HwpRequestMinValid, Setting::HwpRequestMaxValid, Setting::HwpRequestDesiredValid})
+            appendFeatures(out, setting, PWTS::Feature::INTEL_HWP_GROUP, PWTS::Feature::INTEL_HWP_VALID_BITS);
+
+        appendFeatures(out, Setting::HwpRequestPkgEpp, PWTS::Feature::INTEL_HWP_REQ_PKG, PWTS::Feature::INTEL_HWP_EPP);
+        appendFeatures(out, Setting::HwpRequestPkgAcw, PWTS::Feature::INTEL_HWP_REQ_PKG, PWTS::Feature::INTEL_HWP_ACT_WIND);
+        appendFeatures(out, Setting::HwpRequestEpp, PWTS::Feature::INTEL_HWP_GROUP, PWTS::Feature::INTEL_HWP_EPP);
+        appendFeatures(out, Setting::HwpRequestAcw, PWTS::Feature::INTEL_HWP_GROUP, PWTS::Feature::INTEL_HWP_ACT_WIND);
+        appendFeatures(out, Setting::HwpRequestPkgControl, PWTS::Feature::INTEL_HWP_GROUP, PWTS::Feature::INTEL_HWP_REQ_PKG);
+        appendFeatures(out, Setting::HwpRequestAcwValid, PWTS::Feature::INTEL_HWP_VALID_BITS, PWTS::Feature::INTEL_HWP_ACT_WIND);
+        appendFeatures(out, Setting::HwpRequestEppValid, PWTS::Feature::INTEL_HWP_VALID_BITS, PWTS::Feature::INTEL_HWP_EPP);
+        appendFeatures(out, Setting::PkgCstCfgControlCstateLim, PWTS::Feature::INTEL_CPU_GROUP, PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL);
+        appendFeatures(out, Setting::PkgCstCfgControlMaxCoreCstate, PWTS::Feature::INTEL_CPU_GROUP, PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL);
     }
 
     void CliHelperIntel::setClientPacketData() {
-        if (features.cpu.contains(PWTS::Feature::INTEL_CPU_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::INTEL_PKG_POWER_LIMIT))
-                setPkgPowerLimit();
-
-            if (features.cpu.contains(PWTS::Feature::INTEL_VR_CURRENT_CFG))
-                setVrCurrentConfig();
-
-            if (features.cpu.contains(PWTS::Feature::INTEL_PP1_CURRENT_CFG))
-                setPP1();
-
-            if (features.cpu.contains(PWTS::Feature::INTEL_TURBO_POWER_CURRENT_LIMIT_RW))
-                setTurboPowerLimit();
+        skipData(packetData->pkgPowerLimit, packetData->vrCurrentCfg, packetData->pp1CurrentCfg, packetData->turboPowerCurrentLimit,
+                    packetData->pp0Priority, packetData->pp1Priority, packetData->energyPerfBias, packetData->turboRatioLimit,
+                    packetData->miscProcFeatures, packetData->powerCtl, packetData->miscPwrMgmt, packetData->undervoltData,
+                    packetData->hwpEnable, packetData->hwpPkgCtlPolarity, packetData->hwpRequestPkg, packetData->mchbarPkgRaplLimit);
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_CPU_POWER_BALANCE))
-                setCPUPowerBalance();
+        if (features.cpu(PWTS::Feature::INTEL_CPU_GROUP)) {
+            setFields(*packetData, intelCpuSettings);
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_GPU_POWER_BALANCE))
-                setGPUPowerBalance();
+            if (!features.cpu(PWTS::Feature::INTEL_HWP_EPP))
+                setField(*packetData, energyPerfBiasSetting);
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_ENERGY_PERF_BIAS) && !features.cpu.contains(PWTS::Feature::INTEL_HWP_EPP))
-                setEnergyPerfBias();
-
-            if (features.cpu.contains(PWTS::Feature::INTEL_TURBO_RATIO_LIMIT_RW))
+            if (features.cpu(PWTS::Feature::INTEL_TURBO_RATIO_LIMIT_RW))
                 setTurboRatioLimit();
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_IA32_MISC_ENABLE_GROUP))
-                setMiscProcFeatures();
-
-            if (features.cpu.contains(PWTS::Feature::INTEL_POWER_CTL))
-                setPowerCtl();
-
-            if (features.cpu.contains(PWTS::Feature::INTEL_MISC_PWR_MGMT))
-                setMiscPowerMgmt();
-
-            if (features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_GROUP))
-                setFivr();
+            if (features.cpu(PWTS::Feature::INTEL_HWP_GROUP)) {
+                setFields(*packetData, intelHwpSettings);
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_HWP_GROUP)) {
-                setHwpEnable();
-
-                if (features.cpu.contains(PWTS::Feature::INTEL_HWP_CTL))
-                    setHwpPkgCtlPolarityEnable();
-
-                if (features.cpu.contains(PWTS::Feature::INTEL_HWP_REQ_PKG))
+                if (features.cpu(PWTS::Feature::INTEL_HWP_REQ_PKG))
                     setHwpRequestPkg();
             }
         }
 
-        if (features.cpu.contains(PWTS::Feature::INTEL_MCHBAR_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::INTEL_MCHBAR_PKG_RAPL_LIMIT))
-                setMCHBARPkgRaplLimit();
-        }
+        if (features.cpu(PWTS::Feature::INTEL_MCHBAR_GROUP))
+            setFields(*packetData, intelMchbarSettings);
 
-        for (int i=0,l=packetData->coreData.size(); i<l; ++i) {
-            PWTS::Intel::IntelCoreData &core = packetData->coreData[i];
+        PWTS::Intel::IntelCoreData *coreData = packetData->coreData.data();
+        PWTS::Intel::IntelThreadData *threadData = packetData->threadData.data();
+        const bool hasHwp = features.cpu(PWTS::Feature::INTEL_CPU_GROUP) && features.cpu(PWTS::Feature::INTEL_HWP_GROUP);
+        CpuThreadView hwpView = CpuThreadView::hwpView(hasHwp && hasHwpRequestArgs() ? packetData->threadData.size() : 0);
+        CpuThreadView *view = &hwpView;
 
-            setCoreData(core, QString::number(i));
-        }
+        forEachIndex(packetData->coreData.size(), [this, coreData](const int i) {
+            PWTS::Intel::IntelCoreData &core = coreData[i];
 
-        for (int i=0,l=packetData->threadData.size(); i<l; ++i) {
-            PWTS::Intel::IntelThreadData &thd = packetData->threadData[i];
+            skipData(core.pkgCstConfigControl);
+            setCoreData(core, i);
+        });
 
-            setThreadData(thd, QString::number(i));
+        forEachIndex(packetData->threadData.size(), [this, threadData, view](const int i) {
+            PWTS::Intel::IntelThreadData &thd = threadData[i];
+
+            skipData(thd.hwpRequest);
+
+            if (i < view->count)
+                view->setIntelHwp(i, thd);
 
             // delete ro data for this cpu
             thd.hwpCapapabilities = {};
-        }
+        });
+
+        // requests are clamped on the view columns and resolved for all cpus first, they may be sent as a single package request
+        if (hasHwp)
+            setHwpRequest(getHwpRequests(hwpView));
     }
 }
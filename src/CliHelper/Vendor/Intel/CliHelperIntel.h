@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../../CliHelper.h"
+#include "../../../Classes/CpuThreadView.h"
 #include "pwtShared/Include/Data/Vendor/Intel/IntelData.h"
 #include "pwtClientCommon/InputRanges/InputRanges.h"
 
@@ -25,34 +26,24 @@ namespace PWT::CLI {
     class CliHelperIntel final: public CliHelper {
     private:
         QSharedPointer<PWTS::Intel::IntelData> packetData;
-        QSharedPointer<UI::InputRanges> inputRanges;
         int cpuCores;
 
-        void setPkgPowerLimit() const;
-        void setVrCurrentConfig() const;
-        void setPP1() const;
-        void setTurboPowerLimit() const;
-        void setCPUPowerBalance() const;
-        void setGPUPowerBalance() const;
-        void setEnergyPerfBias() const;
         void setTurboRatioLimit() const;
-        void setMiscProcFeatures() const;
-        void setPowerCtl() const;
-        void setMiscPowerMgmt() const;
-        void setFivr() const;
-        void setHwpEnable() const;
-        void setHwpPkgCtlPolarityEnable() const;
         void setHwpRequestPkg() const;
-        void setHwpRequest(PWTS::Intel::IntelThreadData &data, const QString &argIdx) const;
-        void setPkgCstConfigControl(PWTS::Intel::IntelCoreData &data, const QString &argIdx) const;
-        void setMCHBARPkgRaplLimit() const;
-        void setCoreData(PWTS::Intel::IntelCoreData &data, const QString &argIdx) const;
-        void setThreadData(PWTS::Intel::IntelThreadData &data, const QString &argIdx) const;
+        [[nodiscard]] bool hasHwpRequestArgs() const;
+        [[nodiscard]] QList<std::optional<PWTS::Intel::HWPRequest>> getHwpRequests(const CpuThreadView &view) const;
+        [[nodiscard]] bool collapseHwpRequest(const QList<std::optional<PWTS::Intel::HWPRequest>> &requests) const;
+        void setHwpRequest(const QList<std::optional<PWTS::Intel::HWPRequest>> &requests) const;
+        void setPkgCstConfigControl(PWTS::Intel::IntelCoreData &data, const int idx) const;
+        void setCoreData(PWTS::Intel::IntelCoreData &data, const int idx) const;
 
     public:
-        CliHelperIntel(const QSharedPointer<CMDParser> &cmd, const PWTS::Features &daemonFeatures, int coreCount,
+        CliHelperIntel(const QSharedPointer<CMDParser> &cmd, const FeatureSet &daemonFeatures, int coreCount,
                         const QSharedPointer<PWTS::Intel::IntelData> &data, const QSharedPointer<UI::InputRanges> &ranges);
 
         void setClientPacketData() override;
+
+        static void appendSettingRanges(QMap<Setting, SettingBounds> &ranges, const UI::InputRanges &inputRanges);
+        static void appendSettingFeatures(QMap<Setting, SettingFeatures> &out);
     };
 }
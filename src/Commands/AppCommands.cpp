@@ -15,7 +15,10 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <QThreadPool>
+
 #include "AppCommands.h"
+#include "../Classes/CpuThreadView.h"
 #include "pwtClientCommon/CommonUtils.h"
 #include "pwtShared/Utils.h"
 
@@ -82,10 +85,10 @@ namespace PWT::CLI {
 
 #ifdef WITH_INTEL
     [[nodiscard]]
-    static QJsonObject getInputRangesIntelJson(const QSet<PWTS::Feature> &features, const QSharedPointer<UI::InputRanges> &inputRanges) {
+    static QJsonObject getInputRangesIntelJson(const FeatureSet &features, const QSharedPointer<UI::InputRanges> &inputRanges) {
         QJsonObject rangesDB;
 
-        if (features.contains(PWTS::Feature::INTEL_PKG_POWER_LIMIT)) {
+        if (features.cpu(PWTS::Feature::INTEL_PKG_POWER_LIMIT)) {
             const PWTS::MinMax limit = inputRanges->getIntelPl();
             QJsonObject rangeObj;
 
@@ -94,7 +97,7 @@ namespace PWT::CLI {
             rangesDB.insert("pkg_power_limit", rangeObj);
         }
 
-        if (features.contains(PWTS::Feature::INTEL_VR_CURRENT_CFG)) {
+        if (features.cpu(PWTS::Feature::INTEL_VR_CURRENT_CFG)) {
             const PWTS::MinMax limit = inputRanges->getIntelPl4();
             QJsonObject rangeObj;
 
@@ -103,7 +106,7 @@ namespace PWT::CLI {
             rangesDB.insert("vr_current_config", rangeObj);
         }
 
-        if (features.contains(PWTS::Feature::INTEL_PP1_CURRENT_CFG)) {
+        if (features.cpu(PWTS::Feature::INTEL_PP1_CURRENT_CFG)) {
             const PWTS::MinMax limit = inputRanges->getIntelPP1();
             QJsonObject rangeObj;
 
@@ -112,7 +115,7 @@ namespace PWT::CLI {
             rangesDB.insert("pp1_current_config", rangeObj);
         }
 
-        if (features.contains(PWTS::Feature::INTEL_UNDERVOLT_GROUP)) {
+        if (features.cpu(PWTS::Feature::INTEL_UNDERVOLT_GROUP)) {
             const PWTS::MinMax limit = inputRanges->getIntelFIVR();
             QJsonObject rangeObj;
 
@@ -127,11 +130,11 @@ namespace PWT::CLI {
 
 #ifdef WITH_AMD
     [[nodiscard]]
-    static QJsonObject getInputRangesAMDJson(const QSet<PWTS::Feature> &features, const QSharedPointer<UI::InputRanges> &inputRanges) {
+    static QJsonObject getInputRangesAMDJson(const FeatureSet &features, const QSharedPointer<UI::InputRanges> &inputRanges) {
         QJsonObject rangesDB;
 
-        if (features.contains(PWTS::Feature::AMD_CPU_RY_GROUP)) {
-            if (features.contains(PWTS::Feature::AMD_RY_SLOW_LIMIT_W) || features.contains(PWTS::Feature::AMD_RY_FAST_LIMIT_W) || features.contains(PWTS::Feature::AMD_RY_STAPM_LIMIT_W)) {
+        if (features.cpu(PWTS::Feature::AMD_CPU_RY_GROUP)) {
+            if (features.anyCPU(FeatureGroup::ryzenAdjPowerLimitW)) {
                 const PWTS::MinMax limit = inputRanges->getRADJPl();
                 QJsonObject rangeObj;
 
@@ -140,7 +143,7 @@ namespace PWT::CLI {
                 rangesDB.insert("ryzenadj_power_limit", rangeObj);
             }
 
-            if (features.contains(PWTS::Feature::AMD_RY_TCTL_TEMP_W)) {
+            if (features.cpu(PWTS::Feature::AMD_RY_TCTL_TEMP_W)) {
                 const PWTS::MinMax limit = inputRanges->getRADJTctl();
                 QJsonObject rangeObj;
 
@@ -149,7 +152,7 @@ namespace PWT::CLI {
                 rangesDB.insert("ryzenadj_tctl", rangeObj);
             }
 
-            if (features.contains(PWTS::Feature::AMD_RY_APU_SLOW_W)) {
+            if (features.cpu(PWTS::Feature::AMD_RY_APU_SLOW_W)) {
                 const PWTS::MinMax limit = inputRanges->getRADJAPUSlow();
                 QJsonObject rangeObj;
 
@@ -158,7 +161,7 @@ namespace PWT::CLI {
                 rangesDB.insert("ryzenadj_apu_slow_limit", rangeObj);
             }
 
-            if (features.contains(PWTS::Feature::AMD_RY_APU_SKIN_TEMP_W)) {
+            if (features.cpu(PWTS::Feature::AMD_RY_APU_SKIN_TEMP_W)) {
                 const PWTS::MinMax limit = inputRanges->getRADJAPUSkinTemp();
                 QJsonObject rangeObj;
 
@@ -167,7 +170,7 @@ namespace PWT::CLI {
                 rangesDB.insert("ryzenadj_apu_skin_temp", rangeObj);
             }
 
-            if (features.contains(PWTS::Feature::AMD_RY_DGPU_SKIN_TEMP_W)) {
+            if (features.cpu(PWTS::Feature::AMD_RY_DGPU_SKIN_TEMP_W)) {
                 const PWTS::MinMax limit = inputRanges->getRADJDGPUSkinTemp();
                 QJsonObject rangeObj;
 
@@ -176,7 +179,7 @@ namespace PWT::CLI {
                 rangesDB.insert("ryzenadj_dgpu_skin_temp", rangeObj);
             }
 
-            if (features.contains(PWTS::Feature::AMD_RY_VRM_CURRENT_W)) {
+            if (features.cpu(PWTS::Feature::AMD_RY_VRM_CURRENT_W)) {
                 const PWTS::MinMax limit = inputRanges->getRADJVrmCurrent();
                 QJsonObject rangeObj;
 
@@ -185,7 +188,7 @@ namespace PWT::CLI {
                 rangesDB.insert("ryzenadj_vrm_current", rangeObj);
             }
 
-            if (features.contains(PWTS::Feature::AMD_RY_VRM_SOC_CURRENT_W)) {
+            if (features.cpu(PWTS::Feature::AMD_RY_VRM_SOC_CURRENT_W)) {
                 const PWTS::MinMax limit = inputRanges->getRADJVrmSocCurrent();
                 QJsonObject rangeObj;
 
@@ -194,7 +197,7 @@ namespace PWT::CLI {
                 rangesDB.insert("ryzenadj_vrm_soc_current", rangeObj);
             }
 
-            if (features.contains(PWTS::Feature::AMD_RY_STATIC_GFX_CLK_W) || features.contains(PWTS::Feature::AMD_RY_MIN_GFX_CLOCK_W) || features.contains(PWTS::Feature::AMD_RY_MAX_GFX_CLOCK_W)) {
+            if (features.anyCPU(FeatureGroup::ryzenAdjGfxClockW)) {
                 const PWTS::MinMax limit = inputRanges->getRADJGfxClock();
                 QJsonObject rangeObj;
 
@@ -203,7 +206,7 @@ namespace PWT::CLI {
                 rangesDB.insert("ryzenadj_gfx_clock", rangeObj);
             }
 
-            if (features.contains(PWTS::Feature::AMD_RY_CO_ALL_W) || features.contains(PWTS::Feature::AMD_RY_CO_PER_W)) {
+            if (features.anyCPU(FeatureGroup::ryzenAdjCurveOptimizerW)) {
                 const PWTS::MinMax limit = inputRanges->getRADJCO();
                 QJsonObject rangeObj;
 
@@ -226,12 +229,12 @@ namespace PWT::CLI {
         switch (packet.cpuInfo.vendor) {
 #ifdef WITH_INTEL
             case PWTS::CPUVendor::Intel:
-                rangesDB = getInputRangesIntelJson(packet.features.cpu, inputRanges);
+                rangesDB = getInputRangesIntelJson(FeatureSet(packet.features), inputRanges);
                 break;
 #endif
 #ifdef WITH_AMD
             case PWTS::CPUVendor::AMD:
-                rangesDB = getInputRangesAMDJson(packet.features.cpu, inputRanges);
+                rangesDB = getInputRangesAMDJson(FeatureSet(packet.features), inputRanges);
                 break;
 #endif
             default:
@@ -245,21 +248,64 @@ namespace PWT::CLI {
         return jobj;
     }
 
+    // per core/thread section, objects keyed by cpu (schema 1) or arrays indexed by cpu (schema 2)
+    class CpuJsonMap final {
+    private:
+        const FieldSelector fields;
+        const char *keyFormat;
+        const bool asArray;
+        QJsonObject obj;
+        QJsonArray arr;
+
+        [[nodiscard]] QString key(const int idx) const {
+            return asArray ? QString::number(idx) : QString(keyFormat).arg(idx);
+        }
+
+    public:
+        CpuJsonMap(const FieldSelector &sectionFields, const char *format, const bool array): fields(sectionFields), keyFormat(format), asArray(array) {}
+
+        [[nodiscard]] bool wants(const int idx) const {
+            return fields.isAll() || fields.wants(key(idx));
+        }
+
+        void insert(const int idx, const QJsonValue &val) {
+            if (!asArray) {
+                obj.insert(key(idx), val);
+                return;
+            }
+
+            // keep positions, missing cpus are null
+            while (arr.size() < idx)
+                arr.append(QJsonValue::Null);
+
+            arr.append(val);
+        }
+
+        [[nodiscard]] bool isEmpty() const { return asArray ? arr.isEmpty() : obj.isEmpty(); }
+        [[nodiscard]] QJsonValue toJson() const { return asArray ? QJsonValue(arr) : QJsonValue(obj); }
+    };
+
 #ifdef WITH_INTEL
-    static void setIntelCoreDataJson(const QSharedPointer<PWTS::Intel::IntelData> &data, const PWTS::Features &features, QJsonObject &jobj) {
-        QJsonObject pkgCstConfig;
+    static void setIntelCoreDataJson(const QSharedPointer<PWTS::Intel::IntelData> &data, const FeatureSet &features, const FieldSelector &fields, const bool cpuArrays, QJsonObject &jobj) {
+        if (!fields.wants("pkg_cst_config_control"))
+            return;
+
+        CpuJsonMap pkgCstConfig(fields.select("pkg_cst_config_control"), "core_%1", cpuArrays);
         int i = 0;
 
         // gather all data
         for (const PWTS::Intel::IntelCoreData &core: data->coreData) {
-            const QString cpuStr = QString("core_%1").arg(i++);
+            const int coreIdx = i++;
+
+            if (!pkgCstConfig.wants(coreIdx))
+                continue;
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_CPU_GROUP)) {
-                if (features.cpu.contains(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL) && core.pkgCstConfigControl.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_CPU_GROUP)) {
+                if (features.cpu(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL) && core.pkgCstConfigControl.isValid()) {
                     const PWTS::Intel::PkgCstConfigControl val = core.pkgCstConfigControl.getValue();
                     QJsonObject obj;
 
-                    if (features.cpu.contains(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_SB)) {
+                    if (features.cpu(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_SB)) {
                         obj.insert("package_cstate_limit", val.packageCStateLimit);
                         obj.insert("io_mwait_redirection_enable", val.ioMwaitRedirectionEnable);
                         obj.insert("cfg_lock", val.cfgLock);
@@ -268,7 +314,7 @@ namespace PWT::CLI {
                         obj.insert("c3_undemotion_enable", val.c3UndemotionEnable);
                         obj.insert("c1_undemotion_enable", val.c1UndemotionEnable);
 
-                    } else if (features.cpu.contains(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_CU1)) {
+                    } else if (features.cpu(PWTS::Feature::INTEL_PKG_CST_CONFIG_CONTROL_CU1)) {
                         obj.insert("package_cstate_limit", val.packageCStateLimit);
                         obj.insert("max_core_cstate", val.maxCoreCState);
                         obj.insert("io_mwait_redirection_enable", val.ioMwaitRedirectionEnable);
@@ -282,27 +328,33 @@ namespace PWT::CLI {
                         obj.insert("timed_mwait_enable", val.timedMwaitEnable);
                     }
 
-                    pkgCstConfig.insert(cpuStr, obj);
+                    pkgCstConfig.insert(coreIdx, obj);
                 }
             }
         }
 
         // insert data into main obj
-        if (features.cpu.contains(PWTS::Feature::INTEL_CPU_GROUP)) {
+        if (features.cpu(PWTS::Feature::INTEL_CPU_GROUP)) {
             if (!pkgCstConfig.isEmpty())
-                jobj.insert("pkg_cst_config_control", pkgCstConfig);
+                jobj.insert("pkg_cst_config_control", pkgCstConfig.toJson());
         }
     }
 
-    static void setIntelThreadDataJson(const QSharedPointer<PWTS::Intel::IntelData> &data, const PWTS::Features &features, QJsonObject &jobj) {
-        QJsonObject hwpObj;
+    static void setIntelThreadDataJson(const QSharedPointer<PWTS::Intel::IntelData> &data, const FeatureSet &features, const FieldSelector &fields, const bool cpuArrays, QJsonObject &jobj) {
+        if (!fields.wants("hwp_request"))
+            return;
+
+        CpuJsonMap hwpObj(fields.select("hwp_request"), "cpu_%1", cpuArrays);
         int i = 0;
 
         // gather all data
         for (const PWTS::Intel::IntelThreadData &thd: data->threadData) {
-            const QString cpuStr = QString("cpu_%1").arg(i++);
+            const int cpuIdx = i++;
+
+            if (!hwpObj.wants(cpuIdx))
+                continue;
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_HWP_GROUP)) {
+            if (features.cpu(PWTS::Feature::INTEL_HWP_GROUP)) {
                 QJsonObject hwpCpuObj;
 
                 if (thd.hwpCapapabilities.isValid()) {
@@ -322,24 +374,24 @@ namespace PWT::CLI {
                     obj.insert("max_performance", val.requestPkg.max);
                     obj.insert("desired_performance", val.requestPkg.desired);
 
-                    if (features.cpu.contains(PWTS::Feature::INTEL_HWP_ACT_WIND))
+                    if (features.cpu(PWTS::Feature::INTEL_HWP_ACT_WIND))
                         obj.insert("activity_window", val.requestPkg.acw);
 
-                    if (features.cpu.contains(PWTS::Feature::INTEL_HWP_EPP))
+                    if (features.cpu(PWTS::Feature::INTEL_HWP_EPP))
                         obj.insert("energy_performance_preference", val.requestPkg.epp);
 
-                    if (features.cpu.contains(PWTS::Feature::INTEL_HWP_VALID_BITS)) {
+                    if (features.cpu(PWTS::Feature::INTEL_HWP_VALID_BITS)) {
                         obj.insert("min_valid", val.minValid);
                         obj.insert("max_valid", val.maxValid);
                         obj.insert("desired_valid", val.desiredValid);
 
-                        if (features.cpu.contains(PWTS::Feature::INTEL_HWP_ACT_WIND))
+                        if (features.cpu(PWTS::Feature::INTEL_HWP_ACT_WIND))
                             obj.insert("activity_window_valid", val.acwValid);
 
-                        if (features.cpu.contains(PWTS::Feature::INTEL_HWP_EPP))
+                        if (features.cpu(PWTS::Feature::INTEL_HWP_EPP))
                             obj.insert("energy_performance_preference_valid", val.eppValid);
 
-                        if (features.cpu.contains(PWTS::Feature::INTEL_HWP_REQ_PKG))
+                        if (features.cpu(PWTS::Feature::INTEL_HWP_REQ_PKG))
                             obj.insert("package_control", val.packageControl);
                     }
 
@@ -347,26 +399,26 @@ namespace PWT::CLI {
                 }
 
                 if (!hwpCpuObj.isEmpty())
-                    hwpObj.insert(cpuStr, hwpCpuObj);
+                    hwpObj.insert(cpuIdx, hwpCpuObj);
             }
         }
 
         // insert data into main obj
-        if (features.cpu.contains(PWTS::Feature::INTEL_HWP_GROUP)) {
+        if (features.cpu(PWTS::Feature::INTEL_HWP_GROUP)) {
             if (!hwpObj.isEmpty())
-                jobj.insert("hwp_request", hwpObj);
+                jobj.insert("hwp_request", hwpObj.toJson());
         }
     }
 
     [[nodiscard]]
-    static QJsonObject getIntelDataJson(const QSharedPointer<PWTS::Intel::IntelData> &data, const PWTS::Features &features, const int coreCount) {
+    static QJsonObject getIntelDataJson(const QSharedPointer<PWTS::Intel::IntelData> &data, const FeatureSet &features, const int coreCount, const FieldSelector &fields, const bool cpuArrays) {
         QJsonObject jobj;
 
-        setIntelCoreDataJson(data, features, jobj);
-        setIntelThreadDataJson(data, features, jobj);
+        setIntelCoreDataJson(data, features, fields, cpuArrays, jobj);
+        setIntelThreadDataJson(data, features, fields, cpuArrays, jobj);
 
-        if (features.cpu.contains(PWTS::Feature::INTEL_CPU_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::INTEL_VR_CURRENT_CFG) && data->vrCurrentCfg.isValid()) {
+        if (features.cpu(PWTS::Feature::INTEL_CPU_GROUP)) {
+            if (features.cpu(PWTS::Feature::INTEL_VR_CURRENT_CFG) && data->vrCurrentCfg.isValid()) {
                 const PWTS::Intel::VRCurrentConfig val = data->vrCurrentCfg.getValue();
                 QJsonObject obj;
 
@@ -375,74 +427,74 @@ namespace PWT::CLI {
                 jobj.insert("vr_current_config", obj);
             }
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_CPU_POWER_BALANCE) && data->pp0Priority.isValid())
+            if (features.cpu(PWTS::Feature::INTEL_CPU_POWER_BALANCE) && data->pp0Priority.isValid())
                 jobj.insert("pp0_priority", data->pp0Priority.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_GPU_POWER_BALANCE) && data->pp1Priority.isValid())
+            if (features.cpu(PWTS::Feature::INTEL_GPU_POWER_BALANCE) && data->pp1Priority.isValid())
                 jobj.insert("pp1_priority", data->pp1Priority.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_ENERGY_PERF_BIAS) && data->energyPerfBias.isValid())
+            if (features.cpu(PWTS::Feature::INTEL_ENERGY_PERF_BIAS) && data->energyPerfBias.isValid())
                 jobj.insert("performance_energy_bias_hint", data->energyPerfBias.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_GROUP) && data->undervoltData.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_UNDERVOLT_GROUP) && data->undervoltData.isValid()) {
                 const PWTS::Intel::FIVRControlUV val = data->undervoltData.getValue();
                 QJsonObject obj;
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_CPU))
+                if (features.cpu(PWTS::Feature::INTEL_UNDERVOLT_CPU))
                     obj.insert("cpu", val.cpu);
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_GPU))
+                if (features.cpu(PWTS::Feature::INTEL_UNDERVOLT_GPU))
                     obj.insert("gpu", val.gpu);
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_CACHE))
+                if (features.cpu(PWTS::Feature::INTEL_UNDERVOLT_CACHE))
                     obj.insert("cache", val.cpuCache);
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_SYSAGENT))
+                if (features.cpu(PWTS::Feature::INTEL_UNDERVOLT_SYSAGENT))
                     obj.insert("system_agent", val.sa);
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_UNDERVOLT_UNSLICE))
+                if (features.cpu(PWTS::Feature::INTEL_UNDERVOLT_UNSLICE))
                     obj.insert("unslice", val.unslice);
 
                 jobj.insert("fivr", obj);
             }
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_MISC_PWR_MGMT) && data->miscPwrMgmt.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_MISC_PWR_MGMT) && data->miscPwrMgmt.isValid()) {
                 const PWTS::Intel::MiscPwrMgmt val = data->miscPwrMgmt.getValue();
                 QJsonObject obj;
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_MISC_PWR_MGMT_NHLM))
+                if (features.cpu(PWTS::Feature::INTEL_MISC_PWR_MGMT_NHLM))
                     obj.insert("eist_hardware_coordination_disable", val.eistHWCoordinationDisable);
 
                 jobj.insert("misc_pwr_mgmt", obj);
             }
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_IA32_MISC_ENABLE_GROUP) && data->miscProcFeatures.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_IA32_MISC_ENABLE_GROUP) && data->miscProcFeatures.isValid()) {
                 const PWTS::Intel::MiscProcFeatures val = data->miscProcFeatures.getValue();
                 QJsonObject obj;
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_ENHANCED_SPEEDSTEP))
+                if (features.cpu(PWTS::Feature::INTEL_ENHANCED_SPEEDSTEP))
                     obj.insert("enhanced_speedstep", val.enhancedSpeedStep);
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_TURBO_BOOST))
+                if (features.cpu(PWTS::Feature::INTEL_TURBO_BOOST))
                     obj.insert("turbo_boost_disable", val.disableTurboMode);
 
                 jobj.insert("misc_processor_features", obj);
             }
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_POWER_CTL) && data->powerCtl.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_POWER_CTL) && data->powerCtl.isValid()) {
                 const PWTS::Intel::PowerCtl val = data->powerCtl.getValue();
                 QJsonObject obj;
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_POWER_CTL_NHLM)) {
+                if (features.cpu(PWTS::Feature::INTEL_POWER_CTL_NHLM)) {
                     obj.insert("c1_enhanced_enable", val.c1eEnable);
 
-                } else if (features.cpu.contains(PWTS::Feature::INTEL_POWER_CTL_SB)) {
+                } else if (features.cpu(PWTS::Feature::INTEL_POWER_CTL_SB)) {
                     obj.insert("bidirectional_prochot", val.bdProcHot);
                     obj.insert("c1_enhanced_enable", val.c1eEnable);
                     obj.insert("energy_efficiency_optimization_disable", val.disableEnergyEfficiencyOpt);
                     obj.insert("race_to_halt_optimization_disable", val.disableRaceToHaltOpt);
 
-                } else if (features.cpu.contains(PWTS::Feature::INTEL_POWER_CTL_CU1)) {
+                } else if (features.cpu(PWTS::Feature::INTEL_POWER_CTL_CU1)) {
                     obj.insert("bidirectional_prochot", val.bdProcHot);
                     obj.insert("c1_enhanced_enable", val.c1eEnable);
                     obj.insert("self_refresh_pkg_c2_state", val.sapmImcC2Policy);
@@ -464,7 +516,7 @@ namespace PWT::CLI {
                 jobj.insert("power_ctl", obj);
             }
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_PKG_POWER_LIMIT) && data->pkgPowerLimit.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_PKG_POWER_LIMIT) && data->pkgPowerLimit.isValid()) {
                 const PWTS::Intel::PkgPowerLimit val = data->pkgPowerLimit.getValue();
                 QJsonObject obj;
 
@@ -480,7 +532,7 @@ namespace PWT::CLI {
                 jobj.insert("pkg_power_limit", obj);
             }
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_PP1_CURRENT_CFG) && data->pp1CurrentCfg.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_PP1_CURRENT_CFG) && data->pp1CurrentCfg.isValid()) {
                 const PWTS::Intel::PP1CurrentConfig val = data->pp1CurrentCfg.getValue();
                 QJsonObject obj;
 
@@ -489,7 +541,7 @@ namespace PWT::CLI {
                 jobj.insert("pp1_current_config", obj);
             }
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_TURBO_POWER_CURRENT_LIMIT) && data->turboPowerCurrentLimit.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_TURBO_POWER_CURRENT_LIMIT) && data->turboPowerCurrentLimit.isValid()) {
                 const PWTS::Intel::TurboPowerCurrentLimit val = data->turboPowerCurrentLimit.getValue();
                 QJsonObject obj;
 
@@ -500,7 +552,7 @@ namespace PWT::CLI {
                 jobj.insert("turbo_power_current_limit", obj);
             }
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_TURBO_RATIO_LIMIT) && data->turboRatioLimit.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_TURBO_RATIO_LIMIT) && data->turboRatioLimit.isValid()) {
                 const PWTS::Intel::TurboRatioLimit val = data->turboRatioLimit.getValue();
                 const QList<int> ratioList = {
                     val.maxRatioLimit1C, val.maxRatioLimit2C, val.maxRatioLimit3C,
@@ -516,14 +568,14 @@ namespace PWT::CLI {
             }
         }
 
-        if (features.cpu.contains(PWTS::Feature::INTEL_HWP_GROUP)) {
+        if (features.cpu(PWTS::Feature::INTEL_HWP_GROUP)) {
             if (data->hwpEnable.isValid())
                 jobj.insert("hwp_enable", data->hwpEnable.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_HWP_CTL) && data->hwpPkgCtlPolarity.isValid())
+            if (features.cpu(PWTS::Feature::INTEL_HWP_CTL) && data->hwpPkgCtlPolarity.isValid())
                 jobj.insert("hwp_pkg_ctl_polarity_enable", data->hwpPkgCtlPolarity.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::INTEL_HWP_REQ_PKG) && data->hwpRequestPkg.isValid()) {
+            if (features.cpu(PWTS::Feature::INTEL_HWP_REQ_PKG) && data->hwpRequestPkg.isValid()) {
                 const PWTS::Intel::HWPRequestPkg val = data->hwpRequestPkg.getValue();
                 QJsonObject pkgObj;
 
@@ -531,22 +583,22 @@ namespace PWT::CLI {
                 pkgObj.insert("max_performance", val.max);
                 pkgObj.insert("desired_performance", val.desired);
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_HWP_ACT_WIND))
+                if (features.cpu(PWTS::Feature::INTEL_HWP_ACT_WIND))
                     pkgObj.insert("activity_window", val.acw);
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_HWP_EPP))
+                if (features.cpu(PWTS::Feature::INTEL_HWP_EPP))
                     pkgObj.insert("energy_performance_preference", val.epp);
 
                 jobj.insert("hwp_request_pkg", pkgObj);
             }
         }
 
-        if (features.cpu.contains(PWTS::Feature::INTEL_MCHBAR_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::INTEL_MCHBAR_PKG_RAPL_LIMIT) && data->mchbarPkgRaplLimit.isValid()) {
+        if (features.cpu(PWTS::Feature::INTEL_MCHBAR_GROUP)) {
+            if (features.cpu(PWTS::Feature::INTEL_MCHBAR_PKG_RAPL_LIMIT) && data->mchbarPkgRaplLimit.isValid()) {
                 const PWTS::Intel::MCHBARPkgRaplLimit val = data->mchbarPkgRaplLimit.getValue();
                 QJsonObject raplObj;
 
-                if (features.cpu.contains(PWTS::Feature::INTEL_MCHBAR_PKG_RAPL_LIMIT_IVB)) {
+                if (features.cpu(PWTS::Feature::INTEL_MCHBAR_PKG_RAPL_LIMIT_IVB)) {
                     raplObj.insert("pl1", val.pl1);
                     raplObj.insert("pl2", val.pl2);
                     raplObj.insert("pl1_enable", val.pl1Enable);
@@ -554,7 +606,7 @@ namespace PWT::CLI {
                     raplObj.insert("pl1_time", val.pl1Time);
                     raplObj.insert("lock", val.lock);
 
-                } else if (features.cpu.contains(PWTS::Feature::INTEL_MCHBAR_PKG_RAPL_LIMIT_TGL)) {
+                } else if (features.cpu(PWTS::Feature::INTEL_MCHBAR_PKG_RAPL_LIMIT_TGL)) {
                     raplObj.insert("pl1", val.pl1);
                     raplObj.insert("pl2", val.pl2);
                     raplObj.insert("pl1_clamp", val.pl1Clamp);
@@ -573,45 +625,57 @@ namespace PWT::CLI {
 #endif
 
 #ifdef WITH_AMD
-    static void setAmdCoreDataJson(const QSharedPointer<PWTS::AMD::AMDData> &data, const PWTS::Features &features, QJsonObject &jobj) {
-        QJsonObject curveCoreObj;
+    static void setAmdCoreDataJson(const QSharedPointer<PWTS::AMD::AMDData> &data, const FeatureSet &features, const FieldSelector &fields, const bool cpuArrays, QJsonObject &jobj) {
+        if (!fields.wants("curve_optimizer_core"))
+            return;
+
+        CpuJsonMap curveCoreObj(fields.select("curve_optimizer_core"), "core_%1", cpuArrays);
         int i = 0;
 
         // gather all data
         for (const PWTS::AMD::AMDCoreData &core: data->coreData) {
-            const QString coreStr = QString("core_%1").arg(i++);
+            const int coreIdx = i++;
+
+            if (!curveCoreObj.wants(coreIdx))
+                continue;
 
-            if (features.cpu.contains(PWTS::Feature::AMD_CPU_RY_GROUP)) {
-                if (features.cpu.contains(PWTS::Feature::AMD_RY_CO_PER_W) && core.curveOptimizer.isValid())
-                    curveCoreObj.insert(coreStr, core.curveOptimizer.getValue());
+            if (features.cpu(PWTS::Feature::AMD_CPU_RY_GROUP)) {
+                if (features.cpu(PWTS::Feature::AMD_RY_CO_PER_W) && core.curveOptimizer.isValid())
+                    curveCoreObj.insert(coreIdx, core.curveOptimizer.getValue());
             }
         }
 
         // insert data into main obj
-        if (features.cpu.contains(PWTS::Feature::AMD_CPU_RY_GROUP)) {
+        if (features.cpu(PWTS::Feature::AMD_CPU_RY_GROUP)) {
             if (!curveCoreObj.isEmpty())
-                jobj.insert("curve_optimizer_core", curveCoreObj);
+                jobj.insert("curve_optimizer_core", curveCoreObj.toJson());
         }
     }
 
-    static void setAmdThreadDataJson(const QSharedPointer<PWTS::AMD::AMDData> &data, const PWTS::Features &features, QJsonObject &jobj) {
-        QJsonObject hwPstateObj;
-        QJsonObject boostObj;
-        QJsonObject cppcObj;
+    static void setAmdThreadDataJson(const QSharedPointer<PWTS::AMD::AMDData> &data, const FeatureSet &features, const FieldSelector &fields, const bool cpuArrays, QJsonObject &jobj) {
+        const bool wantsHwPstate = fields.wants("hw_pstate");
+        const bool wantsBoost = fields.wants("core_performance_boost");
+        const bool wantsCppc = fields.wants("cppc_request");
+        CpuJsonMap hwPstateObj(fields.select("hw_pstate"), "cpu_%1", cpuArrays);
+        CpuJsonMap boostObj(fields.select("core_performance_boost"), "cpu_%1_disable", cpuArrays);
+        CpuJsonMap cppcObj(fields.select("cppc_request"), "cpu_%1", cpuArrays);
         int i = 0;
 
+        if (!wantsHwPstate && !wantsBoost && !wantsCppc)
+            return;
+
         // gather all data
         for (const PWTS::AMD::AMDThreadData &thd: data->threadData) {
-            const QString cpuStr = QString("cpu_%1").arg(i++);
+            const int cpuIdx = i++;
 
-            if (features.cpu.contains(PWTS::Feature::AMD_CPU_GROUP)) {
-                if (features.cpu.contains(PWTS::Feature::AMD_HWPSTATE) && thd.pstateCmd.isValid())
-                    hwPstateObj.insert(cpuStr, thd.pstateCmd.getValue());
+            if (features.cpu(PWTS::Feature::AMD_CPU_GROUP)) {
+                if (wantsHwPstate && hwPstateObj.wants(cpuIdx) && features.cpu(PWTS::Feature::AMD_HWPSTATE) && thd.pstateCmd.isValid())
+                    hwPstateObj.insert(cpuIdx, thd.pstateCmd.getValue());
 
-                if (features.cpu.contains(PWTS::Feature::AMD_CORE_PERFORMANCE_BOOST) && thd.corePerfBoost.isValid())
-                    boostObj.insert(QString("%1_disable").arg(cpuStr), thd.corePerfBoost.getValue());
+                if (wantsBoost && boostObj.wants(cpuIdx) && features.cpu(PWTS::Feature::AMD_CORE_PERFORMANCE_BOOST) && thd.corePerfBoost.isValid())
+                    boostObj.insert(cpuIdx, thd.corePerfBoost.getValue());
 
-                if (features.cpu.contains(PWTS::Feature::AMD_CPPC)) {
+                if (wantsCppc && cppcObj.wants(cpuIdx) && features.cpu(PWTS::Feature::AMD_CPPC)) {
                     QJsonObject cppcThdObj;
 
                     if (thd.cppcCapability1.isValid()) {
@@ -636,33 +700,33 @@ namespace PWT::CLI {
                         cppcThdObj.insert("request", obj);
                     }
 
-                    cppcObj.insert(cpuStr, cppcThdObj);
+                    cppcObj.insert(cpuIdx, cppcThdObj);
                 }
             }
         }
 
         // insert data into main obj
-        if (features.cpu.contains(PWTS::Feature::AMD_CPU_GROUP)) {
+        if (features.cpu(PWTS::Feature::AMD_CPU_GROUP)) {
             if (!hwPstateObj.isEmpty())
-                jobj.insert("hw_pstate", hwPstateObj);
+                jobj.insert("hw_pstate", hwPstateObj.toJson());
 
             if (!boostObj.isEmpty())
-                jobj.insert("core_performance_boost", boostObj);
+                jobj.insert("core_performance_boost", boostObj.toJson());
 
             if (!cppcObj.isEmpty())
-                jobj.insert("cppc_request", cppcObj);
+                jobj.insert("cppc_request", cppcObj.toJson());
         }
     }
 
     [[nodiscard]]
-    static QJsonObject getAmdDataJson(const QSharedPointer<PWTS::AMD::AMDData> &data, const PWTS::Features &features) {
+    static QJsonObject getAmdDataJson(const QSharedPointer<PWTS::AMD::AMDData> &data, const FeatureSet &features, const FieldSelector &fields, const bool cpuArrays) {
         QJsonObject jobj;
 
-        setAmdCoreDataJson(data, features, jobj);
-        setAmdThreadDataJson(data, features, jobj);
+        setAmdCoreDataJson(data, features, fields, cpuArrays, jobj);
+        setAmdThreadDataJson(data, features, fields, cpuArrays, jobj);
 
-        if (features.cpu.contains(PWTS::Feature::AMD_CPU_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::AMD_HWPSTATE) && data->pstateCurrentLimit.isValid()) {
+        if (features.cpu(PWTS::Feature::AMD_CPU_GROUP)) {
+            if (features.cpu(PWTS::Feature::AMD_HWPSTATE) && data->pstateCurrentLimit.isValid()) {
                 const PWTS::AMD::PStateCurrentLimit val = data->pstateCurrentLimit.getValue();
                 QJsonObject obj;
 
@@ -671,54 +735,54 @@ namespace PWT::CLI {
                 jobj.insert("hw_pstate_limits", obj);
             }
 
-            if (features.cpu.contains(PWTS::Feature::AMD_CPPC) && data->cppcEnableBit.isValid())
+            if (features.cpu(PWTS::Feature::AMD_CPPC) && data->cppcEnableBit.isValid())
                 jobj.insert("cppc_enable", data->cppcEnableBit.getValue());
         }
 
-        if (features.cpu.contains(PWTS::Feature::AMD_CPU_RY_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_APU_SKIN_TEMP_W) && data->apuSkinTemp.isValid())
+        if (features.cpu(PWTS::Feature::AMD_CPU_RY_GROUP)) {
+            if (features.cpu(PWTS::Feature::AMD_RY_APU_SKIN_TEMP_W) && data->apuSkinTemp.isValid())
                 jobj.insert("apu_skin_temp", data->apuSkinTemp.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_APU_SLOW_W) && data->apuSlow.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_APU_SLOW_W) && data->apuSlow.isValid())
                 jobj.insert("apu_slow_limit", data->apuSlow.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_DGPU_SKIN_TEMP_W) && data->dgpuSkinTemp.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_DGPU_SKIN_TEMP_W) && data->dgpuSkinTemp.isValid())
                 jobj.insert("dgpu_skin_temp", data->dgpuSkinTemp.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_FAST_LIMIT_W) && data->fastLimit.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_FAST_LIMIT_W) && data->fastLimit.isValid())
                 jobj.insert("fast_limit", data->fastLimit.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_MIN_GFX_CLOCK_W) && data->minGfxClock.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_MIN_GFX_CLOCK_W) && data->minGfxClock.isValid())
                 jobj.insert("min_gfx_clock", data->minGfxClock.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_MAX_GFX_CLOCK_W) && data->maxGfxClock.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_MAX_GFX_CLOCK_W) && data->maxGfxClock.isValid())
                 jobj.insert("max_gfx_clock", data->maxGfxClock.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_SLOW_LIMIT_W) && data->slowLimit.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_SLOW_LIMIT_W) && data->slowLimit.isValid())
                 jobj.insert("slow_limit", data->slowLimit.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_STAPM_LIMIT_W) && data->stapmLimit.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_STAPM_LIMIT_W) && data->stapmLimit.isValid())
                 jobj.insert("stapm_limit", data->stapmLimit.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_TCTL_TEMP_W) && data->tctlTemp.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_TCTL_TEMP_W) && data->tctlTemp.isValid())
                 jobj.insert("tctl_temp", data->tctlTemp.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_VRM_CURRENT_W) && data->vrmCurrent.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_VRM_CURRENT_W) && data->vrmCurrent.isValid())
                 jobj.insert("vrm_current", data->vrmCurrent.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_VRM_MAX_CURRENT_W) && data->vrmMaxCurrent.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_VRM_MAX_CURRENT_W) && data->vrmMaxCurrent.isValid())
                 jobj.insert("vrm_max_current", data->vrmMaxCurrent.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_VRM_SOC_CURRENT_W) && data->vrmSocCurrent.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_VRM_SOC_CURRENT_W) && data->vrmSocCurrent.isValid())
                 jobj.insert("vrm_soc_current", data->vrmSocCurrent.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_VRM_SOC_MAX_CURRENT_W) && data->vrmSocMaxCurrent.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_VRM_SOC_MAX_CURRENT_W) && data->vrmSocMaxCurrent.isValid())
                 jobj.insert("vrm_soc_max_current", data->vrmSocMaxCurrent.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_POWER_PROFILE_W) && data->powerProfile.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_POWER_PROFILE_W) && data->powerProfile.isValid())
                 jobj.insert("power_profile", data->powerProfile.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::AMD_RY_CO_ALL_W) && data->curveOptimizer.isValid())
+            if (features.cpu(PWTS::Feature::AMD_RY_CO_ALL_W) && data->curveOptimizer.isValid())
                 jobj.insert("curve_optimizer_all", data->curveOptimizer.getValue());
         }
 
@@ -727,12 +791,12 @@ namespace PWT::CLI {
 #endif
 
     [[nodiscard]]
-    static QJsonObject getLinuxIntelGPUDataJson(const int index, const PWTS::LNX::LinuxIntelGPUData &data, const QSet<PWTS::Feature> &features) {
+    static QJsonObject getLinuxIntelGPUDataJson(const int index, const PWTS::LNX::LinuxIntelGPUData &data, const FeatureSet &features) {
         QJsonObject jobj;
 
         jobj.insert("gpu_index", index);
 
-        if (features.contains(PWTS::Feature::INTEL_GPU_SYSFS_GROUP)) {
+        if (features.gpu(index, PWTS::Feature::INTEL_GPU_SYSFS_GROUP)) {
             if (data.rpsLimits.isValid()) {
                 const PWTS::LNX::Intel::GPURPSLimits val = data.rpsLimits.getValue();
                 QJsonObject obj;
@@ -742,7 +806,7 @@ namespace PWT::CLI {
                 jobj.insert("rps_limits", obj);
             }
 
-            if (features.contains(PWTS::Feature::INTEL_GPU_RPS_FREQ_SYSFS) && data.frequency.isValid()) {
+            if (features.gpu(index, PWTS::Feature::INTEL_GPU_RPS_FREQ_SYSFS) && data.frequency.isValid()) {
                 const PWTS::MinMax val = data.frequency.getValue();
                 QJsonObject obj;
 
@@ -751,7 +815,7 @@ namespace PWT::CLI {
                 jobj.insert("frequency", obj);
             }
 
-            if (features.contains(PWTS::Feature::INTEL_GPU_BOOST_SYSFS) && data.boostFrequency.isValid())
+            if (features.gpu(index, PWTS::Feature::INTEL_GPU_BOOST_SYSFS) && data.boostFrequency.isValid())
                 jobj.insert("boost_frequency", data.boostFrequency.getValue());
         }
 
@@ -759,13 +823,13 @@ namespace PWT::CLI {
     }
 
     [[nodiscard]]
-    static QJsonObject getLinuxAMDGPUDataJson(const int index, const PWTS::LNX::LinuxAMDGPUData &data, const QSet<PWTS::Feature> &features) {
+    static QJsonObject getLinuxAMDGPUDataJson(const int index, const PWTS::LNX::LinuxAMDGPUData &data, const FeatureSet &features) {
         QJsonObject jobj;
 
         jobj.insert("gpu_index", index);
 
-        if (features.contains(PWTS::Feature::AMD_GPU_SYSFS_GROUP)) {
-            if (features.contains(PWTS::Feature::AMD_GPU_DPM_FORCE_PERF_LEVEL_SYSFS)) {
+        if (features.gpu(index, PWTS::Feature::AMD_GPU_SYSFS_GROUP)) {
+            if (features.gpu(index, PWTS::Feature::AMD_GPU_DPM_FORCE_PERF_LEVEL_SYSFS)) {
                 if (data.odRanges.isValid()) {
                     const PWTS::LNX::AMD::GPUODRanges val = data.odRanges.getValue();
                     QJsonObject sclkObj;
@@ -790,39 +854,47 @@ namespace PWT::CLI {
                 }
             }
 
-            if (features.contains(PWTS::Feature::AMD_GPU_POWER_DPM_STATE_SYSFS) && data.powerDpmState.isValid())
+            if (features.gpu(index, PWTS::Feature::AMD_GPU_POWER_DPM_STATE_SYSFS) && data.powerDpmState.isValid())
                 jobj.insert("power_dpm_state", data.powerDpmState.getValue());
         }
 
         return jobj;
     }
 
-    static void setLinuxThreadDataJson(const QSharedPointer<PWTS::LNX::LinuxData> &data, const PWTS::Features &features, QJsonObject &jobj) {
-        QJsonObject scalingGovObj;
-        QJsonObject cpuFreqObj;
-        QJsonObject cpuStatusObj;
+    static void setLinuxThreadDataJson(const QSharedPointer<PWTS::LNX::LinuxData> &data, const FeatureSet &features, const FieldSelector &fields, const bool cpuArrays, QJsonObject &jobj) {
+        const bool wantsScalingGov = fields.wants("scaling_governor");
+        const bool wantsCpuFreq = fields.wants("cpu_frequency");
+        const bool wantsCpuStatus = fields.wants("cpu_online_status");
+        CpuJsonMap scalingGovObj(fields.select("scaling_governor"), "cpu_%1", cpuArrays);
+        CpuJsonMap cpuFreqObj(fields.select("cpu_frequency"), "cpu_%1", cpuArrays);
+        CpuJsonMap cpuStatusObj(fields.select("cpu_online_status"), "cpu_%1", cpuArrays);
         int i = 0;
 
+        if (!wantsScalingGov && !wantsCpuFreq && !wantsCpuStatus)
+            return;
+
         // gather all data
         for (const PWTS::LNX::LinuxThreadData &thd: data->threadData) {
-            const QString cpuStr = QString("cpu_%1").arg(i++);
+            const int cpuIdx = i++;
 
-            if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
-                if (features.cpu.contains(PWTS::Feature::CPUFREQ_SYSFS)) {
+            if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
+                if (features.cpu(PWTS::Feature::CPUFREQ_SYSFS)) {
+                    const bool scalingGovSelected = wantsScalingGov && scalingGovObj.wants(cpuIdx);
+                    const bool cpuFreqSelected = wantsCpuFreq && cpuFreqObj.wants(cpuIdx);
                     QJsonObject scalingGovThdObj;
                     QJsonObject cpuFreqThdObj;
 
-                    if (thd.scalingAvailableGovernors.isValid()) {
+                    if (scalingGovSelected && thd.scalingAvailableGovernors.isValid()) {
                         const PWTS::LNX::CPUScalingAvailableGovernors val = thd.scalingAvailableGovernors.getValue();
 
                         scalingGovThdObj.insert("available_governors", QJsonArray::fromStringList(val.availableGovernors));
                         scalingGovThdObj.insert("related_cpus", QJsonArray::fromStringList(val.relatedCPUs));
                     }
 
-                    if (thd.scalingGovernor.isValid())
+                    if (scalingGovSelected && thd.scalingGovernor.isValid())
                         scalingGovThdObj.insert("governor", thd.scalingGovernor.getValue());
 
-                    if (thd.cpuFrequencyLimits.isValid()) {
+                    if (cpuFreqSelected && thd.cpuFrequencyLimits.isValid()) {
                         const PWTS::LNX::CPUFrequencyLimits val = thd.cpuFrequencyLimits.getValue();
                         QJsonObject obj;
 
@@ -832,7 +904,7 @@ namespace PWT::CLI {
                         cpuFreqThdObj.insert("limits", obj);
                     }
 
-                    if (thd.cpuFrequency.isValid()) {
+                    if (cpuFreqSelected && thd.cpuFrequency.isValid()) {
                         const PWTS::MinMax val = thd.cpuFrequency.getValue();
                         QJsonObject obj;
 
@@ -842,13 +914,13 @@ namespace PWT::CLI {
                     }
 
                     if (!scalingGovThdObj.isEmpty())
-                        scalingGovObj.insert(cpuStr, scalingGovThdObj);
+                        scalingGovObj.insert(cpuIdx, scalingGovThdObj);
 
                     if (!cpuFreqThdObj.isEmpty())
-                        cpuFreqObj.insert(cpuStr, cpuFreqThdObj);
+                        cpuFreqObj.insert(cpuIdx, cpuFreqThdObj);
                 }
 
-                if (features.cpu.contains(PWTS::Feature::CPU_PARK_SYSFS)) {
+                if (wantsCpuStatus && cpuStatusObj.wants(cpuIdx) && features.cpu(PWTS::Feature::CPU_PARK_SYSFS)) {
                     QJsonObject obj;
 
                     if (thd.cpuLogicalOffAvailable.isValid())
@@ -861,35 +933,45 @@ namespace PWT::CLI {
                         obj.insert("real_core_id", thd.coreID.getValue());
 
                     if (!obj.isEmpty())
-                        cpuStatusObj.insert(cpuStr, obj);
+                        cpuStatusObj.insert(cpuIdx, obj);
                 }
             }
         }
 
         // insert data into main obj
-        if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
+        if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
             if (!scalingGovObj.isEmpty())
-                jobj.insert("scaling_governor", scalingGovObj);
+                jobj.insert("scaling_governor", scalingGovObj.toJson());
 
             if (!cpuFreqObj.isEmpty())
-                jobj.insert("cpu_frequency", cpuFreqObj);
+                jobj.insert("cpu_frequency", cpuFreqObj.toJson());
 
             if (!cpuStatusObj.isEmpty())
-                jobj.insert("cpu_online_status", cpuStatusObj);
+                jobj.insert("cpu_online_status", cpuStatusObj.toJson());
         }
     }
 
     [[nodiscard]]
-    static QJsonObject getLinuxDataJson(const QSharedPointer<PWTS::LNX::LinuxData> &data, const PWTS::Features &features) {
+    static QJsonObject getLinuxDataJson(const QSharedPointer<PWTS::LNX::LinuxData> &data, const FeatureSet &features, const FieldSelector &fields, const bool cpuArrays) {
+        const FieldSelector blockQueSchedFields = fields.select("block_devices_queue_scheduler");
+        const FieldSelector miscPmDevsFields = fields.select("misc_pm_devices");
+        const FieldSelector intelGpusFields = fields.select("intel_gpus");
+        const FieldSelector amdGpusFields = fields.select("amd_gpus");
         QJsonArray intelGpusArr;
         QJsonArray amdGpusArr;
         QJsonObject blockQueSchedObj;
         QJsonObject miscPmDevsObj;
         QJsonObject jobj;
 
-        setLinuxThreadDataJson(data, features, jobj);
+        setLinuxThreadDataJson(data, features, fields, cpuArrays, jobj);
 
         for (const auto &[blkDev, devData]: data->blockDevicesQueSched.asKeyValueRange()) {
+            if (!fields.wants("block_devices_queue_scheduler"))
+                break;
+
+            if (!blockQueSchedFields.wants(blkDev))
+                continue;
+
             QJsonObject obj;
 
             obj.insert("label", devData.name);
@@ -899,6 +981,12 @@ namespace PWT::CLI {
         }
 
         for (const PWTS::LNX::MiscPMDevice &dev: data->miscPMDevices) {
+            if (!fields.wants("misc_pm_devices"))
+                break;
+
+            if (!miscPmDevsFields.wants(dev.control))
+                continue;
+
             QJsonObject obj;
 
             obj.insert("runtime", dev.controlValue);
@@ -906,11 +994,11 @@ namespace PWT::CLI {
             miscPmDevsObj.insert(dev.control, obj);
         }
 
-        if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::CPU_SMT_SYSFS) && data->smtState.isValid())
+        if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
+            if (features.cpu(PWTS::Feature::CPU_SMT_SYSFS) && data->smtState.isValid())
                 jobj.insert("smt", data->smtState.getValue());
 
-            if (features.cpu.contains(PWTS::Feature::CPUIDLE_GOV_SYSFS) && data->cpuIdleGovernor.isValid()) {
+            if (features.cpu(PWTS::Feature::CPUIDLE_GOV_SYSFS) && data->cpuIdleGovernor.isValid()) {
                 QJsonObject obj;
 
                 if (data->cpuIdleAvailableGovernors.isValid())
@@ -921,11 +1009,24 @@ namespace PWT::CLI {
             }
         }
 
-        for (const auto &[index, gpuData]: data->intelGpuData.asKeyValueRange())
-            intelGpusArr.append(getLinuxIntelGPUDataJson(index, gpuData, features.gpus[index].second));
+        if (fields.wants("intel_gpus")) {
+            for (const auto &[index, gpuData]: data->intelGpuData.asKeyValueRange()) {
+                // gpu arrays are addressed by position, unselected ones are dropped in projection
+                if (intelGpusFields.wants(QString::number(intelGpusArr.size())))
+                    intelGpusArr.append(getLinuxIntelGPUDataJson(index, gpuData, features));
+                else
+                    intelGpusArr.append(QJsonValue::Null);
+            }
+        }
 
-        for (const auto &[index, gpuData]: data->amdGpuData.asKeyValueRange())
-            amdGpusArr.append(getLinuxAMDGPUDataJson(index, gpuData, features.gpus[index].second));
+        if (fields.wants("amd_gpus")) {
+            for (const auto &[index, gpuData]: data->amdGpuData.asKeyValueRange()) {
+                if (amdGpusFields.wants(QString::number(amdGpusArr.size())))
+                    amdGpusArr.append(getLinuxAMDGPUDataJson(index, gpuData, features));
+                else
+                    amdGpusArr.append(QJsonValue::Null);
+            }
+        }
 
         if (!intelGpusArr.isEmpty())
             jobj.insert("intel_gpus", intelGpusArr);
@@ -943,15 +1044,21 @@ namespace PWT::CLI {
     }
 
 #ifdef WITH_AMD
-    static void setLinuxAMDThreadDataJson(const QSharedPointer<PWTS::LNX::AMD::LinuxAMDData> &data, const PWTS::Features &features, QJsonObject &jobj) {
-        QJsonObject pstateObj;
+    static void setLinuxAMDThreadDataJson(const QSharedPointer<PWTS::LNX::AMD::LinuxAMDData> &data, const FeatureSet &features, const FieldSelector &fields, const bool cpuArrays, QJsonObject &jobj) {
+        if (!fields.wants("pstate"))
+            return;
+
+        CpuJsonMap pstateObj(fields.select("pstate"), "cpu_%1", cpuArrays);
         int i = 0;
 
         for (const PWTS::LNX::AMD::LinuxAMDThreadData &thd: data->threadData) {
-            const QString cpuStr = QString("cpu_%1").arg(i++);
+            const int cpuIdx = i++;
 
-            if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
-                if (features.cpu.contains(PWTS::Feature::AMD_PSTATE_SYSFS)) {
+            if (!pstateObj.wants(cpuIdx))
+                continue;
+
+            if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
+                if (features.cpu(PWTS::Feature::AMD_PSTATE_SYSFS)) {
                     QJsonObject obj;
 
                     if (thd.pstateData.isValid()) {
@@ -963,25 +1070,25 @@ namespace PWT::CLI {
                     if (thd.epp.isValid())
                         obj.insert("energy_performance_preference", thd.epp.getValue());
 
-                    pstateObj.insert(cpuStr, obj);
+                    pstateObj.insert(cpuIdx, obj);
                 }
             }
         }
 
-        if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
+        if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
             if (!pstateObj.isEmpty())
-                jobj.insert("pstate", pstateObj);
+                jobj.insert("pstate", pstateObj.toJson());
         }
     }
 
     [[nodiscard]]
-    static QJsonObject getLinuxAMDDataJson(const QSharedPointer<PWTS::LNX::AMD::LinuxAMDData> &data, const PWTS::Features &features) {
+    static QJsonObject getLinuxAMDDataJson(const QSharedPointer<PWTS::LNX::AMD::LinuxAMDData> &data, const FeatureSet &features, const FieldSelector &fields, const bool cpuArrays) {
         QJsonObject jobj;
 
-        setLinuxAMDThreadDataJson(data, features, jobj);
+        setLinuxAMDThreadDataJson(data, features, fields, cpuArrays, jobj);
 
-        if (features.cpu.contains(PWTS::Feature::SYSFS_GROUP)) {
-            if (features.cpu.contains(PWTS::Feature::AMD_PSTATE_SYSFS) && data->pstateStatus.isValid())
+        if (features.cpu(PWTS::Feature::SYSFS_GROUP)) {
+            if (features.cpu(PWTS::Feature::AMD_PSTATE_SYSFS) && data->pstateStatus.isValid())
                 jobj.insert("pstate_status", data->pstateStatus.getValue());
         }
 
@@ -990,17 +1097,28 @@ namespace PWT::CLI {
 #endif
 
     [[nodiscard]]
-    static QJsonObject getWindowsDataJson(const QSharedPointer<PWTS::WIN::WindowsData> &data, const PWTS::Features &features) {
+    static QJsonObject getWindowsDataJson(const QSharedPointer<PWTS::WIN::WindowsData> &data, const FeatureSet &features, const FieldSelector &fields) {
         QJsonObject jobj;
 
-        if (features.cpu.contains(PWTS::Feature::PWR_SCHEME_GROUP)) {
+        if (features.cpu(PWTS::Feature::PWR_SCHEME_GROUP)) {
+            const FieldSelector schemesFields = fields.select("schemes");
             QJsonObject schemesObj;
 
             for (const auto &[guidStr, schemeData]: data->schemes.asKeyValueRange()) {
+                if (!fields.wants("schemes"))
+                    break;
+
+                if (!schemesFields.wants(guidStr))
+                    continue;
+
+                const FieldSelector schemeSettFields = schemesFields.select(guidStr).select("settings");
                 QJsonObject schemeSettObj;
                 QJsonObject schemeDataObj;
 
                 for (const auto &[settingGuid, setting]: schemeData.settings.asKeyValueRange()) {
+                    if (!schemeSettFields.wants(settingGuid))
+                        continue;
+
                     const PWTS::WIN::PowerSchemeSettingData &settData = data->schemeOptionsData[settingGuid];
                     QJsonObject settObj;
 
@@ -1046,13 +1164,18 @@ namespace PWT::CLI {
     }
 
     [[nodiscard]]
-    static QJsonObject getFansDataJson(const PWTS::DaemonPacket &packet, const PWTS::Features &features) {
-        if (features.fans.isEmpty())
+    static QJsonObject getFansDataJson(const PWTS::DaemonPacket &packet, const FeatureSet &features, const FieldSelector &fields) {
+        if (!features.hasFans())
             return {};
 
         QJsonObject fansObj;
 
         for (const auto &[fanID, fan]: packet.fanData.asKeyValueRange()) {
+            const QString fanStr = QString("fan_%1").arg(fanID);
+
+            if (!fields.wants(fanStr))
+                continue;
+
             const int mode = fan.mode.getValue();
             QJsonObject fanObj;
             QJsonObject curveObj;
@@ -1064,30 +1187,64 @@ namespace PWT::CLI {
                 curveObj.insert(QString("%1C").arg(temp), speed);
 
             fanObj.insert("curve", curveObj);
-            fansObj.insert(QString("fan_%1").arg(fanID), fanObj);
+            fansObj.insert(fanStr, fanObj);
         }
 
         return fansObj;
     }
 
+    // below this many cpu threads, sections are built serially
+    static constexpr int parallelSectionsMinThreads = 64;
+
+    struct DeviceDataSection final {
+        const char *key;
+        std::function<QJsonObject()> build;
+        QJsonObject data;
+    };
+
     [[nodiscard]]
-    static QJsonObject getDeviceDataJson(const PWTS::DaemonPacket &packet, const PWTS::Features &features, const int coreCount) {
-        QTextStream ts(stdout, QIODevice::WriteOnly);
+    static int getPacketThreadCount(const PWTS::DaemonPacket &packet) {
+        int count = 0;
+
+#ifdef WITH_INTEL
+        if (!packet.intelData.isNull())
+            count = qMax(count, static_cast<int>(packet.intelData->threadData.size()));
+#endif
+#ifdef WITH_AMD
+        if (!packet.amdData.isNull())
+            count = qMax(count, static_cast<int>(packet.amdData->threadData.size()));
+#endif
+        if (!packet.linuxData.isNull())
+            count = qMax(count, static_cast<int>(packet.linuxData->threadData.size()));
+
+        return count;
+    }
+
+    QJsonObject getDeviceDataJson(const PWTS::DaemonPacket &packet, const FeatureSet &features, const int coreCount, const DeviceDataOptions &options) {
+        const FieldSelector &fields = options.fields;
+        const bool cpuArrays = options.schema >= 2;
+        QList<DeviceDataSection> sections;
         QJsonObject jobj;
 
+        // sections not matched by the selector are never built
         switch (packet.vendor) {
 #ifdef WITH_INTEL
-            case PWTS::CPUVendor::Intel:
-                jobj.insert("intel", getIntelDataJson(packet.intelData, features, coreCount));
+            case PWTS::CPUVendor::Intel: {
+                if (fields.wants("intel"))
+                    sections.append({"intel", [&] { return getIntelDataJson(packet.intelData, features, coreCount, fields.select("intel"), cpuArrays); }, {}});
+            }
                 break;
 #endif
 #ifdef WITH_AMD
             case PWTS::CPUVendor::AMD: {
-                jobj.insert("amd", getAmdDataJson(packet.amdData, features));
+                if (fields.wants("amd"))
+                    sections.append({"amd", [&] { return getAmdDataJson(packet.amdData, features, fields.select("amd"), cpuArrays); }, {}});
 
                 switch (packet.os) {
-                    case PWTS::OSType::Linux:
-                        jobj.insert("linux_amd", getLinuxAMDDataJson(packet.linuxAmdData, features));
+                    case PWTS::OSType::Linux: {
+                        if (fields.wants("linux_amd"))
+                            sections.append({"linux_amd", [&] { return getLinuxAMDDataJson(packet.linuxAmdData, features, fields.select("linux_amd"), cpuArrays); }, {}});
+                    }
                         break;
                     default:
                         break;
@@ -1100,23 +1257,366 @@ namespace PWT::CLI {
         }
 
         switch (packet.os) {
-            case PWTS::OSType::Linux:
-                jobj.insert("linux", getLinuxDataJson(packet.linuxData, features));
+            case PWTS::OSType::Linux: {
+                if (fields.wants("linux"))
+                    sections.append({"linux", [&] { return getLinuxDataJson(packet.linuxData, features, fields.select("linux"), cpuArrays); }, {}});
+            }
                 break;
-            case PWTS::OSType::Windows:
-                jobj.insert("windows", getWindowsDataJson(packet.windowsData, features));
+            case PWTS::OSType::Windows: {
+                if (fields.wants("windows"))
+                    sections.append({"windows", [&] { return getWindowsDataJson(packet.windowsData, features, fields.select("windows")); }, {}});
+            }
                 break;
             default:
                 break;
         }
 
-        jobj.insert("fan_control", getFansDataJson(packet, features));
+        if (fields.wants("fan_control"))
+            sections.append({"fan_control", [&] { return getFansDataJson(packet, features, fields.select("fan_control")); }, {}});
+
+        // builders only read the packet and each one writes its own slot
+        if (sections.size() > 1 && getPacketThreadCount(packet) >= parallelSectionsMinThreads) {
+            QThreadPool pool;
+
+            for (DeviceDataSection &section: sections)
+                pool.start([&section] { section.data = section.build(); });
+
+            pool.waitForDone();
+
+        } else {
+            for (DeviceDataSection &section: sections)
+                section.data = section.build();
+        }
+
+        for (const DeviceDataSection &section: sections)
+            jobj.insert(section.key, section.data);
+
+        // drop leaf values not matched by the selector
+        jobj = fields.project(jobj);
+
+        if (cpuArrays)
+            jobj.insert("schema", options.schema);
+
+        return jobj;
+    }
+
+    QJsonObject getDeviceDataDiffJson(const QJsonObject &current, const QJsonObject &planned) {
+        QJsonObject jobj;
+
+        // keys only in current are ro data, deleted from client packet
+        for (auto it = planned.constBegin(); it != planned.constEnd(); ++it) {
+            const QString key = it.key();
+            const QJsonValue value = it.value();
+            const QJsonValue curValue = current.value(key);
+            QJsonObject change;
+
+            if (curValue == value)
+                continue;
+
+            if (curValue.isObject() && value.isObject()) {
+                const QJsonObject diff = getDeviceDataDiffJson(curValue.toObject(), value.toObject());
+
+                if (!diff.isEmpty())
+                    jobj.insert(key, diff);
+
+                continue;
+            }
+
+            if (!curValue.isUndefined())
+                change.insert("from", curValue);
+
+            change.insert("to", value);
+            jobj.insert(key, change);
+        }
+
+        return jobj;
+    }
+
+    [[nodiscard]]
+    static bool isDeviceDataChange(const QJsonObject &obj) {
+        return obj.contains("to") && (obj.size() == 1 || (obj.size() == 2 && obj.contains("from")));
+    }
+
+    QJsonObject getVerifyJson(const QJsonObject &changes, const QJsonObject &deviceData) {
+        QJsonObject jobj;
+
+        for (auto it = changes.constBegin(); it != changes.constEnd(); ++it) {
+            const QJsonObject change = it.value().toObject();
+            const QJsonValue value = deviceData.value(it.key());
+
+            if (!isDeviceDataChange(change)) {
+                const QJsonObject mismatch = getVerifyJson(change, value.toObject());
+
+                if (!mismatch.isEmpty())
+                    jobj.insert(it.key(), mismatch);
+
+                continue;
+            }
+
+            if (change.value("to") == value)
+                continue;
+
+            QJsonObject obj;
+
+            obj.insert("requested", change.value("to"));
+            obj.insert("value", value.isUndefined() ? QJsonValue() : value);
+            jobj.insert(it.key(), obj);
+        }
 
         return jobj;
     }
 
+    class TableRowWriter final {
+    private:
+        QTextStream &ts;
+        const QChar separator;
+        bool firstField = true;
+
+        void writeSeparator() {
+            if (!firstField)
+                ts << separator;
+
+            firstField = false;
+        }
+
+    public:
+        TableRowWriter(QTextStream &stream, const OutputFormat format): ts(stream), separator(format == OutputFormat::TSV ? '\t':',') {}
+
+        void addInt(const qint64 val) {
+            writeSeparator();
+            ts << val;
+        }
+
+        void addInt(const bool valid, const qint64 val) {
+            if (valid)
+                addInt(val);
+            else
+                skip();
+        }
+
+        void addStr(const QString &val) {
+            writeSeparator();
+
+            if (val.contains(separator) || val.contains('"') || val.contains('\n'))
+                ts << '"' << QString(val).replace('"', "\"\"") << '"';
+            else
+                ts << val;
+        }
+
+        void addStr(const bool valid, const QString &val) {
+            if (valid)
+                addStr(val);
+            else
+                skip();
+        }
+
+        void skip() {
+            writeSeparator();
+        }
+
+        void endRow() {
+            ts << '\n';
+            firstField = true;
+        }
+    };
+
+    static void writeCPUTable(const PWTS::DaemonPacket &packet, const FeatureSet &features, const OutputFormat format) {
+        QTextStream ts(OutputWriter::getInstance().get());
+        TableRowWriter row(ts, format);
+        const bool isLinux = packet.os == PWTS::OSType::Linux && !packet.linuxData.isNull() && features.cpu(PWTS::Feature::SYSFS_GROUP);
+        const bool hasCpuFreq = isLinux && features.cpu(PWTS::Feature::CPUFREQ_SYSFS);
+        const bool hasCpuPark = isLinux && features.cpu(PWTS::Feature::CPU_PARK_SYSFS);
+        const qsizetype linuxThreads = isLinux ? packet.linuxData->threadData.size() : 0;
+#ifdef WITH_INTEL
+        const bool hasHwp = packet.vendor == PWTS::CPUVendor::Intel && !packet.intelData.isNull() && features.cpu(PWTS::Feature::INTEL_HWP_GROUP);
+        const bool hasHwpAcw = hasHwp && features.cpu(PWTS::Feature::INTEL_HWP_ACT_WIND);
+        const bool hasHwpEpp = hasHwp && features.cpu(PWTS::Feature::INTEL_HWP_EPP);
+        const bool hasHwpPkgCtl = hasHwp && features.cpu(PWTS::Feature::INTEL_HWP_VALID_BITS) && features.cpu(PWTS::Feature::INTEL_HWP_REQ_PKG);
+        const qsizetype intelThreads = hasHwp ? packet.intelData->threadData.size() : 0;
+#endif
+#ifdef WITH_AMD
+        const bool isAmd = packet.vendor == PWTS::CPUVendor::AMD && !packet.amdData.isNull() && features.cpu(PWTS::Feature::AMD_CPU_GROUP);
+        const bool hasHwPstate = isAmd && features.cpu(PWTS::Feature::AMD_HWPSTATE);
+        const bool hasBoost = isAmd && features.cpu(PWTS::Feature::AMD_CORE_PERFORMANCE_BOOST);
+        const bool hasCppc = isAmd && features.cpu(PWTS::Feature::AMD_CPPC);
+        const bool hasPstateEpp = isLinux && packet.vendor == PWTS::CPUVendor::AMD && !packet.linuxAmdData.isNull() && features.cpu(PWTS::Feature::AMD_PSTATE_SYSFS);
+        const qsizetype amdThreads = isAmd ? packet.amdData->threadData.size() : 0;
+        const qsizetype linuxAmdThreads = hasPstateEpp ? packet.linuxAmdData->threadData.size() : 0;
+#endif
+        qsizetype rows = linuxThreads;
+
+        row.addStr("cpu");
+
+        if (hasCpuFreq) {
+            row.addStr("scaling_governor");
+            row.addStr("frequency_min");
+            row.addStr("frequency_max");
+            row.addStr("frequency_limit_min");
+            row.addStr("frequency_limit_max");
+        }
+
+        if (hasCpuPark) {
+            row.addStr("online_status");
+            row.addStr("real_core_id");
+        }
+#ifdef WITH_INTEL
+        if (hasHwp) {
+            rows = qMax(rows, intelThreads);
+            row.addStr("hwp_min_performance");
+            row.addStr("hwp_max_performance");
+            row.addStr("hwp_desired_performance");
+
+            if (hasHwpAcw)
+                row.addStr("hwp_activity_window");
+
+            if (hasHwpEpp)
+                row.addStr("hwp_energy_performance_preference");
+
+            if (hasHwpPkgCtl)
+                row.addStr("hwp_package_control");
+        }
+#endif
+#ifdef WITH_AMD
+        rows = qMax(rows, qMax(amdThreads, linuxAmdThreads));
+
+        if (hasHwPstate)
+            row.addStr("hw_pstate");
+
+        if (hasBoost)
+            row.addStr("core_performance_boost_disable");
+
+        if (hasCppc) {
+            row.addStr("cppc_min_performance");
+            row.addStr("cppc_max_performance");
+            row.addStr("cppc_desired_performance");
+            row.addStr("cppc_energy_performance_preference");
+        }
+
+        if (hasPstateEpp)
+            row.addStr("pstate_energy_performance_preference");
+#endif
+        row.endRow();
+
+        const CpuThreadView view(packet);
+
+        // one row per cpu, read from the view columns
+        for (qsizetype i=0; i<rows; ++i) {
+            row.addInt(i);
+
+            if (hasCpuFreq) {
+                row.addStr(view.scalingGovernor.valid[i], view.scalingGovernor.values[i]);
+                row.addInt(view.freqMin.valid[i], view.freqMin.values[i]);
+                row.addInt(view.freqMax.valid[i], view.freqMax.values[i]);
+                row.addInt(view.freqLimitMin.valid[i], view.freqLimitMin.values[i]);
+                row.addInt(view.freqLimitMax.valid[i], view.freqLimitMax.values[i]);
+            }
+
+            if (hasCpuPark) {
+                row.addInt(view.onlineStatus.valid[i], view.onlineStatus.values[i]);
+                row.addInt(view.coreID.valid[i], view.coreID.values[i]);
+            }
+#ifdef WITH_INTEL
+            if (hasHwp) {
+                row.addInt(view.hwpMin.valid[i], view.hwpMin.values[i]);
+                row.addInt(view.hwpMax.valid[i], view.hwpMax.values[i]);
+                row.addInt(view.hwpDesired.valid[i], view.hwpDesired.values[i]);
+
+                if (hasHwpAcw)
+                    row.addInt(view.hwpAcw.valid[i], view.hwpAcw.values[i]);
+
+                if (hasHwpEpp)
+                    row.addInt(view.hwpEpp.valid[i], view.hwpEpp.values[i]);
+
+                if (hasHwpPkgCtl)
+                    row.addInt(view.hwpPkgControl.valid[i], view.hwpPkgControl.values[i]);
+            }
+#endif
+#ifdef WITH_AMD
+            if (hasHwPstate)
+                row.addInt(view.pstateCmd.valid[i], view.pstateCmd.values[i]);
+
+            if (hasBoost)
+                row.addInt(view.corePerfBoost.valid[i], view.corePerfBoost.values[i]);
+
+            if (hasCppc) {
+                row.addInt(view.cppcMin.valid[i], view.cppcMin.values[i]);
+                row.addInt(view.cppcMax.valid[i], view.cppcMax.values[i]);
+                row.addInt(view.cppcDesired.valid[i], view.cppcDesired.values[i]);
+                row.addInt(view.cppcEpp.valid[i], view.cppcEpp.values[i]);
+            }
+
+            if (hasPstateEpp)
+                row.addStr(view.pstateEpp.valid[i], view.pstateEpp.values[i]);
+#endif
+            row.endRow();
+        }
+    }
+
+    static void writeGPUTable(const PWTS::DaemonPacket &packet, const FeatureSet &features, const OutputFormat format) {
+        QTextStream ts(OutputWriter::getInstance().get());
+        TableRowWriter row(ts, format);
+
+        row.addStr("gpu_index");
+        row.addStr("vendor");
+        row.addStr("frequency_min");
+        row.addStr("frequency_max");
+        row.addStr("boost_frequency");
+        row.addStr("rp0");
+        row.addStr("rpn");
+        row.addStr("sclk_min");
+        row.addStr("sclk_max");
+        row.addStr("dpm_force_performance_level");
+        row.addStr("power_dpm_state");
+        row.endRow();
+
+        if (packet.os != PWTS::OSType::Linux || packet.linuxData.isNull())
+            return;
+
+        for (const auto &[index, gpuData]: packet.linuxData->intelGpuData.asKeyValueRange()) {
+            const bool hasGroup = features.gpu(index, PWTS::Feature::INTEL_GPU_SYSFS_GROUP);
+            const bool freqValid = hasGroup && features.gpu(index, PWTS::Feature::INTEL_GPU_RPS_FREQ_SYSFS) && gpuData.frequency.isValid();
+            const bool boostValid = hasGroup && features.gpu(index, PWTS::Feature::INTEL_GPU_BOOST_SYSFS) && gpuData.boostFrequency.isValid();
+            const bool rpsValid = hasGroup && gpuData.rpsLimits.isValid();
+            const PWTS::MinMax freq = freqValid ? gpuData.frequency.getValue() : PWTS::MinMax {};
+            const PWTS::LNX::Intel::GPURPSLimits rps = rpsValid ? gpuData.rpsLimits.getValue() : PWTS::LNX::Intel::GPURPSLimits {};
+
+            row.addInt(index);
+            row.addStr(QStringLiteral("intel"));
+            row.addInt(freqValid, freq.min);
+            row.addInt(freqValid, freq.max);
+            row.addInt(boostValid, boostValid ? gpuData.boostFrequency.getValue() : 0);
+            row.addInt(rpsValid, rps.rp0);
+            row.addInt(rpsValid, rps.rpn);
+            row.skip();
+            row.skip();
+            row.skip();
+            row.skip();
+            row.endRow();
+        }
+
+        for (const auto &[index, gpuData]: packet.linuxData->amdGpuData.asKeyValueRange()) {
+            const bool hasGroup = features.gpu(index, PWTS::Feature::AMD_GPU_SYSFS_GROUP);
+            const bool dpmValid = hasGroup && features.gpu(index, PWTS::Feature::AMD_GPU_DPM_FORCE_PERF_LEVEL_SYSFS) && gpuData.dpmForcePerfLevel.isValid();
+            const bool dpmStateValid = hasGroup && features.gpu(index, PWTS::Feature::AMD_GPU_POWER_DPM_STATE_SYSFS) && gpuData.powerDpmState.isValid();
+            const PWTS::LNX::AMD::GPUDPMForcePerfLevel dpm = dpmValid ? gpuData.dpmForcePerfLevel.getValue() : PWTS::LNX::AMD::GPUDPMForcePerfLevel {};
+
+            row.addInt(index);
+            row.addStr(QStringLiteral("amd"));
+            row.skip();
+            row.skip();
+            row.skip();
+            row.skip();
+            row.skip();
+            row.addInt(dpmValid, dpm.sclk.min);
+            row.addInt(dpmValid, dpm.sclk.max);
+            row.addStr(dpmValid, dpm.level);
+            row.addStr(dpmStateValid, dpmStateValid ? gpuData.powerDpmState.getValue() : QString());
+            row.endRow();
+        }
+    }
+
     void printDataPath(const QString &path) {
-        QTextStream ts(stdout, QIODevice::WriteOnly);
+        QTextStream ts(OutputWriter::getInstance().get());
         QJsonObject jobj;
 
         jobj.insert("path", path);
@@ -1125,7 +1625,7 @@ namespace PWT::CLI {
     }
 
     void printDaemons(const QJsonArray &daemons) {
-        QTextStream ts(stdout, QIODevice::WriteOnly);
+        QTextStream ts(OutputWriter::getInstance().get());
         QJsonObject jobj;
 
         jobj.insert("daemons", daemons);
@@ -1136,7 +1636,7 @@ namespace PWT::CLI {
     void printDeviceInfo(const PWTS::DeviceInfoPacket &packet, const QSharedPointer<FileLogger> &logger, const QSharedPointer<UI::InputRanges> &inputRanges) {
         const QSharedPointer<PWTS::DaemonSettings> daemonSettings = QSharedPointer<PWTS::DaemonSettings>::create();
         const QJsonObject jobj = getDeviceInfoJson(packet, daemonSettings, inputRanges);
-        QTextStream ts(stdout, QIODevice::WriteOnly);
+        QTextStream ts(OutputWriter::getInstance().get());
 
         if (!daemonSettings->load(packet.daemonSettings))
             logger->write(QStringLiteral("failed to load daemon settings, using defaults"));
@@ -1144,23 +1644,36 @@ namespace PWT::CLI {
         ts << QJsonDocument(jobj).toJson().toStdString().c_str();
     }
 
-    void printDeviceData(const PWTS::DaemonPacket &packet, const PWTS::Features &features, const int coreCount) {
-        const QJsonObject jobj = getDeviceDataJson(packet, features, coreCount);
-        QTextStream ts(stdout, QIODevice::WriteOnly);
+    void printDeviceData(const PWTS::DaemonPacket &packet, const FeatureSet &features, const int coreCount, const DeviceDataOptions &options) {
+        const QJsonObject jobj = getDeviceDataJson(packet, features, coreCount, options);
+        QTextStream ts(OutputWriter::getInstance().get());
 
         ts << QJsonDocument(jobj).toJson().toStdString().c_str();
     }
 
+    void printDeviceDataTable(const PWTS::DaemonPacket &packet, const FeatureSet &features, const OutputFormat format, const DeviceDataTable table) {
+        switch (table) {
+            case DeviceDataTable::CPUs:
+                writeCPUTable(packet, features, format);
+                break;
+            case DeviceDataTable::GPUs:
+                writeGPUTable(packet, features, format);
+                break;
+            default:
+                break;
+        }
+    }
+
     void printDaemonSettings(const QSharedPointer<PWTS::DaemonSettings> &daemonSettings) {
         const QJsonObject jobj = getDaemonSettingsJson(daemonSettings);
-        QTextStream ts(stdout, QIODevice::WriteOnly);
+        QTextStream ts(OutputWriter::getInstance().get());
 
         ts << QJsonDocument(jobj).toJson().toStdString().c_str();
     }
 
     void printProfileList(const QList<QString> &list) {
         const QJsonArray jarr = QJsonArray::fromStringList(list);
-        QTextStream ts(stdout, QIODevice::WriteOnly);
+        QTextStream ts(OutputWriter::getInstance().get());
         QJsonObject jobj;
 
         jobj.insert("profiles", jarr);
@@ -1168,8 +1681,22 @@ namespace PWT::CLI {
         ts << QJsonDocument(jobj).toJson().toStdString().c_str();
     }
 
-    void printApplyResults(const QSet<PWTS::DError> &errors, const QString &profile) {
-        QTextStream ts(stdout, QIODevice::WriteOnly);
+    // package_control is true when it was left enabled on all cpus by the collapse
+    [[nodiscard]]
+    static QJsonObject getCollapsedJson(const QList<Setting> &collapsed) {
+        QJsonObject obj;
+        QJsonArray arr;
+
+        for (const Setting setting: collapsed)
+            arr.append(settingName(setting));
+
+        obj.insert("settings", arr);
+        obj.insert("package_control", !collapsed.isEmpty());
+        return obj;
+    }
+
+    void printApplyResults(const QSet<PWTS::DError> &errors, const QString &profile, const QJsonObject &verify, const QList<Setting> &collapsed) {
+        QTextStream ts(OutputWriter::getInstance().get());
         QJsonObject jobj;
         QJsonArray errList;
 
@@ -1181,6 +1708,101 @@ namespace PWT::CLI {
 
         jobj.insert("errors", errList);
 
+        if (!collapsed.isEmpty())
+            jobj.insert("collapsed_to_package", getCollapsedJson(collapsed));
+
+        if (!verify.isEmpty())
+            jobj.insert("verify", verify);
+
+        ts << QJsonDocument(jobj).toJson().toStdString().c_str();
+    }
+
+    [[nodiscard]]
+    static QString getSettingErrorStr(const SettingError::Kind kind) {
+        switch (kind) {
+            case SettingError::Kind::Unknown:
+                return QStringLiteral("unknown");
+            case SettingError::Kind::Unsupported:
+                return QStringLiteral("unsupported");
+            case SettingError::Kind::InvalidValue:
+                return QStringLiteral("invalid_value");
+            case SettingError::Kind::OutOfRange:
+                return QStringLiteral("out_of_range");
+            default:
+                break;
+        }
+
+        return {};
+    }
+
+    void printSettingErrors(const QList<SettingError> &errors) {
+        QTextStream ts(OutputWriter::getInstance().get());
+        QJsonArray errList;
+        QJsonObject jobj;
+
+        for (const SettingError &err: errors) {
+            QJsonObject obj;
+
+            obj.insert("error", getSettingErrorStr(err.kind));
+
+            if (err.kind == SettingError::Kind::Unknown) {
+                obj.insert("setting", err.value);
+
+            } else {
+                obj.insert("setting", settingName(err.setting));
+
+                if (!err.value.isEmpty())
+                    obj.insert("value", err.value);
+            }
+
+            if (err.bounds) {
+                obj.insert("min", err.bounds->min);
+                obj.insert("max", err.bounds->max);
+            }
+
+            errList.append(obj);
+        }
+
+        jobj.insert("result", "invalid");
+        jobj.insert("errors", errList);
+
+        ts << QJsonDocument(jobj).toJson().toStdString().c_str();
+    }
+
+    void printApplyNoop() {
+        QTextStream ts(OutputWriter::getInstance().get());
+        QJsonObject jobj;
+
+        jobj.insert("result", "no-op");
+        jobj.insert("errors", QJsonArray());
+
+        ts << QJsonDocument(jobj).toJson().toStdString().c_str();
+    }
+
+    void printApplyPlan(const QJsonObject &current, const QJsonObject &planned, const ClientPacketInfo &info) {
+        QTextStream ts(OutputWriter::getInstance().get());
+        QJsonArray clampedArr;
+        QJsonObject jobj;
+
+        for (const ClampedValue &clamped: info.clamped) {
+            QJsonObject obj;
+
+            obj.insert("setting", settingName(clamped.setting));
+
+            if (!clamped.index.isEmpty())
+                obj.insert("index", clamped.index);
+
+            obj.insert("requested", clamped.requested);
+            obj.insert("value", clamped.value);
+            clampedArr.append(obj);
+        }
+
+        jobj.insert("dry_run", true);
+        jobj.insert("changes", info.changes);
+        jobj.insert("diff", getDeviceDataDiffJson(current, planned));
+        jobj.insert("clamped", clampedArr);
+        jobj.insert("collapsed_to_package", getCollapsedJson(info.collapsed));
+
         ts << QJsonDocument(jobj).toJson().toStdString().c_str();
     }
 }
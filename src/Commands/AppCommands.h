@@ -23,15 +23,32 @@
 #include "pwtShared/DaemonSettings.h"
 #include "pwtClientCommon/InputRanges/InputRanges.h"
 #include "../Classes/FileLogger.h"
+#include "../Classes/FeatureSet.h"
+#include "../CliHelper/CliHelper.h"
 #include "../Classes/CLISettings.h"
+#include "../Classes/FieldSelector.h"
+#include "../Classes/OutputWriter.h"
+#include "../Include/OutputFormat.h"
 
 namespace PWT::CLI {
+    struct DeviceDataOptions final {
+        FieldSelector fields;
+        int schema = 1; // 2: per cpu sections as arrays
+    };
+
     [[nodiscard]] bool addDaemons(const QList<QString> &data, const QScopedPointer<CLISettings> &cliSettings, const QSharedPointer<FileLogger> &logger);
     void printDataPath(const QString &path);
     void printDaemons(const QJsonArray &daemons);
+    [[nodiscard]] QJsonObject getDeviceDataJson(const PWTS::DaemonPacket &packet, const FeatureSet &features, int coreCount, const DeviceDataOptions &options);
+    [[nodiscard]] QJsonObject getDeviceDataDiffJson(const QJsonObject &current, const QJsonObject &planned);
+    [[nodiscard]] QJsonObject getVerifyJson(const QJsonObject &changes, const QJsonObject &deviceData);
     void printDeviceInfo(const PWTS::DeviceInfoPacket &packet, const QSharedPointer<FileLogger> &logger, const QSharedPointer<UI::InputRanges> &inputRanges);
-    void printDeviceData(const PWTS::DaemonPacket &packet, const PWTS::Features &features, int coreCount);
+    void printDeviceData(const PWTS::DaemonPacket &packet, const FeatureSet &features, int coreCount, const DeviceDataOptions &options);
+    void printDeviceDataTable(const PWTS::DaemonPacket &packet, const FeatureSet &features, OutputFormat format, DeviceDataTable table);
     void printDaemonSettings(const QSharedPointer<PWTS::DaemonSettings> &daemonSettings);
     void printProfileList(const QList<QString> &list);
-    void printApplyResults(const QSet<PWTS::DError> &errors, const QString &profile = "");
+    void printApplyResults(const QSet<PWTS::DError> &errors, const QString &profile = "", const QJsonObject &verify = {}, const QList<Setting> &collapsed = {});
+    void printApplyNoop();
+    void printSettingErrors(const QList<SettingError> &errors);
+    void printApplyPlan(const QJsonObject &current, const QJsonObject &planned, const ClientPacketInfo &info);
 }
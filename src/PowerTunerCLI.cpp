@@ -40,12 +40,13 @@ namespace PWT::CLI {
         logger = FileLogger::getInstance();
         globalDataPath = QString("%1/PowerTuner").arg(QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation));
         dataPath = QString("%1/cli").arg(globalDataPath);
-        cmdParser = QSharedPointer<CMDParser>::create();
 
         if (!qdir.exists(dataPath) && !qdir.mkpath(dataPath))
             dataPath.clear();
 
+        cmdParser = QSharedPointer<CMDParser>::create(dataPath);
         cliSettings.reset(new CLISettings(dataPath));
+        completionCache.reset(new CompletionCache(dataPath));
         logger->init(dataPath);
 
         QObject::connect(cliSettings.get(), &CLISettings::logMessageSent, this, &PowerTunerCLI::onLogMessageSent);
@@ -58,8 +59,44 @@ namespace PWT::CLI {
         inputRanges->load(packet.sysInfo.product, packet.cpuInfo.brand);
     }
 
+    bool PowerTunerCLI::initOutputOptions() {
+        const QString compression = cmdParser->getCmdValue(CMDArg::OUTPUT_FILE, "compression").toString();
+        OutputCompression outputCompression = OutputCompression::None;
+
+        if (compression == "gzip")
+            outputCompression = OutputCompression::GZip;
+        else if (compression == "zstd")
+            outputCompression = OutputCompression::ZStd;
+
+        if (!OutputWriter::getInstance()->init(cmdParser->getCmdValue(CMDArg::OUTPUT_FILE, "path").toString(), outputCompression)) {
+            logger->write(QStringLiteral("failed to init output"));
+            return false;
+        }
+
+        if (cmdParser->isSet(CMDArg::OUTPUT_FIELDS) && !deviceDataOptions.fields.parse(cmdParser->getCmdValue(CMDArg::OUTPUT_FIELDS, "paths").toString())) {
+            logger->write(QStringLiteral("invalid fields selector"));
+            return false;
+        }
+
+        if (cmdParser->isSet(CMDArg::OUTPUT_FORMAT)) {
+            const QString format = cmdParser->getCmdValue(CMDArg::OUTPUT_FORMAT, "format").toString();
+
+            if (format == "csv")
+                outputFormat = OutputFormat::CSV;
+            else if (format == "tsv")
+                outputFormat = OutputFormat::TSV;
+
+            if (cmdParser->getCmdValue(CMDArg::OUTPUT_FORMAT, "table").toString() == "gpus")
+                outputTable = DeviceDataTable::GPUs;
+
+            deviceDataOptions.schema = cmdParser->getCmdValue(CMDArg::OUTPUT_FORMAT, "schema").toInt();
+        }
+
+        return true;
+    }
+
     void PowerTunerCLI::run(const int argc, char *argv[]) {
-        if (!cmdParser->parse(argc, argv)) {
+        if (!cmdParser->parse(argc, argv) || !initOutputOptions()) {
             emit quit(1);
             return;
         }
@@ -101,13 +138,70 @@ namespace PWT::CLI {
             if (!ret)
                 logger->write(QStringLiteral("failed to remove some daemons"));
 
+            completionCache->remove(cmdParser->getCmdValue(CMDArg::SET_REMOVE_DAEMONS, "daemons").toStringList());
+
             emit quit(!ret);
 
         } else if (cmdParser->isSet(CMDArg::DAEMON)) {
+            if (cmdParser->isSet(CMDArg::SET_DEVICE_SETTINGS) && cmdParser->isSet(CMDArg::SET_STRICT) && !validateStrictSettings()) {
+                emit quit(1);
+                return;
+            }
+
             initService(); // this cmd requires daemon connection, lets handle it after connection
         }
     }
 
+    bool PowerTunerCLI::validateStrictSettings() const {
+        const QString dname = cmdParser->getCmdValue(CMDArg::DAEMON, "name").toString();
+        const std::optional<DeviceCapabilities> capabilities = completionCache->read(dname);
+        QList<SettingError> errors = cmdParser->getUnknownSettings();
+
+        if (capabilities)
+            errors.append(cmdParser->validateSettings(*capabilities));
+        else
+            logger->write(QStringLiteral("no capabilities cached for this daemon, settings are checked after connecting"));
+
+        if (errors.isEmpty())
+            return true;
+
+        printSettingErrors(errors);
+        return false;
+    }
+
+    QMap<Setting, SettingBounds> PowerTunerCLI::getSettingRanges(const PWTS::DaemonPacket &packet) const {
+        QMap<Setting, SettingBounds> ranges;
+
+        if (inputRanges.isNull())
+            return ranges;
+
+#ifdef WITH_INTEL
+        if (packet.vendor == PWTS::CPUVendor::Intel)
+            CliHelperIntel::appendSettingRanges(ranges, *inputRanges);
+#endif
+#ifdef WITH_AMD
+        if (packet.vendor == PWTS::CPUVendor::AMD)
+            CliHelperAMD::appendSettingRanges(ranges, *inputRanges);
+#endif
+
+        return ranges;
+    }
+
+    QMap<Setting, SettingFeatures> PowerTunerCLI::getSettingFeatures(const PWTS::DaemonPacket &packet) const {
+        QMap<Setting, SettingFeatures> settingFeatures;
+
+#ifdef WITH_INTEL
+        if (packet.vendor == PWTS::CPUVendor::Intel)
+            CliHelperIntel::appendSettingFeatures(settingFeatures);
+#endif
+#ifdef WITH_AMD
+        if (packet.vendor == PWTS::CPUVendor::AMD)
+            CliHelperAMD::appendSettingFeatures(settingFeatures);
+#endif
+
+        return settingFeatures;
+    }
+
     void PowerTunerCLI::initService() {
         const QString dname = cmdParser->getCmdValue(CMDArg::DAEMON, "name").toString();
         QString adr;
@@ -138,76 +232,58 @@ namespace PWT::CLI {
         }
 
         service.reset(new PWTCS::ClientService);
+        asyncService.reset(new AsyncService(service.get()));
 
         QObject::connect(service.get(), &PWTCS::ClientService::logMessageSent, this, &PowerTunerCLI::onServiceLogSent);
-        QObject::connect(service.get(), &PWTCS::ClientService::serviceConnected, this, &PowerTunerCLI::onServiceConnected);
         QObject::connect(service.get(), &PWTCS::ClientService::serviceError, this, &PowerTunerCLI::onServiceError);
         QObject::connect(service.get(), &PWTCS::ClientService::commandFailed, this, &PowerTunerCLI::onServiceCommandFailed);
         QObject::connect(service.get(), &PWTCS::ClientService::serviceDisconnected, this, &PowerTunerCLI::onServiceDisconnected);
-        QObject::connect(service.get(), &PWTCS::ClientService::deviceInfoPacketReceived, this, &PowerTunerCLI::onServiceDeviceInfoPacketReceived);
-        QObject::connect(service.get(), &PWTCS::ClientService::daemonPacketReceived, this, &PowerTunerCLI::onServiceDaemonPacketReceived);
-        QObject::connect(service.get(), &PWTCS::ClientService::daemonSettingsReceived, this, &PowerTunerCLI::onServiceDaemonSettingsReceived);
-        QObject::connect(service.get(), &PWTCS::ClientService::daemonSettingsApplied, this, &PowerTunerCLI::onServiceDaemonSettingsApplied);
-        QObject::connect(service.get(), &PWTCS::ClientService::settingsApplied, this, &PowerTunerCLI::onServiceSettingsApplied);
-        QObject::connect(service.get(), &PWTCS::ClientService::profileListReceived, this, &PowerTunerCLI::onServiceProfileListReceived);
-        QObject::connect(service.get(), &PWTCS::ClientService::profileDeleted, this, &PowerTunerCLI::onServiceProfileDeleted);
-        QObject::connect(service.get(), &PWTCS::ClientService::profileApplied, this, &PowerTunerCLI::onServiceProfileApplied);
-        QObject::connect(service.get(), &PWTCS::ClientService::profileWritten, this, &PowerTunerCLI::onServiceProfileWritten);
-        QObject::connect(service.get(), &PWTCS::ClientService::profilesExported, this, &PowerTunerCLI::onServiceProfilesExported);
-        QObject::connect(service.get(), &PWTCS::ClientService::profilesImported, this, &PowerTunerCLI::onServiceProfilesImported);
-
-        service->connectToDaemon(adr, port);
-    }
-
-    void PowerTunerCLI::importProfiles() const {
-        const QList<QString> list = cmdParser->getCmdValue(CMDArg::SET_IMPORT_PROFILES, "profiles").toStringList();
-        QHash<QString, QByteArray> imports;
 
-        for (const QString &file: list) {
-            if (!PWTS::isValidProfileForImport(file))
-                continue;
+        runDaemonCommand(adr, port).start();
+    }
 
-            const QFileInfo finfo {file};
-            QFile f {file};
+    template<typename T>
+    [[nodiscard]]
+    static QSharedPointer<T> copyPacketData(const QSharedPointer<T> &data) {
+        if (data.isNull())
+            return {};
 
-            if (f.open(QFile::ReadOnly))
-                imports.insert(finfo.baseName(), f.readAll());
-            else
-                logger->write(QString("cannot import profile '%1', skip").arg(file));
-        }
-
-        service->sendImportProfilesRequest(imports);
+        return QSharedPointer<T>::create(*data);
     }
 
-    PWTS::ClientPacket PowerTunerCLI::createClientPacket(const PWTS::DaemonPacket &packet) const {
-        const std::unique_ptr<CliHelperFan> fanHelper = std::make_unique<CliHelperFan>(cmdParser, features, packet.fanData);
+    PWTS::ClientPacket PowerTunerCLI::createClientPacket(const PWTS::DaemonPacket &packet, ClientPacketInfo &info) const {
         PWTS::ClientPacket cpacket {};
 
-        fanHelper->setClientPacketData();
-
         // no gui to read values from
-        // to have a complete packet, copy daemon packet and update its values
-        // ro data is unused in client packet and will be deleted
-        // this also allows to create valid profiles
+        // to have a complete packet, the client packet owns a copy of the daemon packet data and the helpers update it in place,
+        // ro data is unused in client packet and is deleted in the same pass.
+        // this also allows to create valid profiles, the daemon packet is left untouched
         cpacket.os = packet.os;
         cpacket.vendor = packet.vendor;
-        cpacket.fanData = fanHelper->getData();
+        cpacket.fanData = packet.fanData; // shared until a fan is changed
+
+        const std::unique_ptr<CliHelperFan> fanHelper = std::make_unique<CliHelperFan>(cmdParser, features, cpacket.fanData, packet.fanData);
+
+        fanHelper->setClientPacketData();
+        fanHelper->addPacketInfo(info);
 
         switch (packet.os) {
             case PWTS::OSType::Linux: {
-                const std::unique_ptr<CliHelperLinux> helper = std::make_unique<CliHelperLinux>(cmdParser, features, packet.linuxData);
+                cpacket.linuxData = copyPacketData(packet.linuxData);
 
-                cpacket.linuxData = packet.linuxData;
+                const std::unique_ptr<CliHelperLinux> helper = std::make_unique<CliHelperLinux>(cmdParser, features, cpacket.linuxData);
 
                 helper->setClientPacketData();
+                helper->addPacketInfo(info);
             }
                 break;
             case PWTS::OSType::Windows: {
-                const std::unique_ptr<CliHelperWindows> helper = std::make_unique<CliHelperWindows>(cmdParser, features, packet.windowsData);
+                cpacket.windowsData = copyPacketData(packet.windowsData);
 
-                cpacket.windowsData = packet.windowsData;
+                const std::unique_ptr<CliHelperWindows> helper = std::make_unique<CliHelperWindows>(cmdParser, features, cpacket.windowsData);
 
                 helper->setClientPacketData();
+                helper->addPacketInfo(info);
             }
                 break;
             default:
@@ -217,29 +293,32 @@ namespace PWT::CLI {
         switch (packet.vendor) {
 #ifdef WITH_INTEL
             case PWTS::CPUVendor::Intel: {
-                const std::unique_ptr<CliHelperIntel> helper = std::make_unique<CliHelperIntel>(cmdParser, features, coreCount, packet.intelData, inputRanges);
+                cpacket.intelData = copyPacketData(packet.intelData);
 
-                cpacket.intelData = packet.intelData;
+                const std::unique_ptr<CliHelperIntel> helper = std::make_unique<CliHelperIntel>(cmdParser, features, coreCount, cpacket.intelData, inputRanges);
 
                 helper->setClientPacketData();
+                helper->addPacketInfo(info);
             }
                 break;
 #endif
 #ifdef WITH_AMD
             case PWTS::CPUVendor::AMD: {
-                const std::unique_ptr<CliHelperAMD> helper = std::make_unique<CliHelperAMD>(cmdParser, features, packet.amdData, inputRanges);
+                cpacket.amdData = copyPacketData(packet.amdData);
 
-                cpacket.amdData = packet.amdData;
+                const std::unique_ptr<CliHelperAMD> helper = std::make_unique<CliHelperAMD>(cmdParser, features, cpacket.amdData, inputRanges);
 
                 helper->setClientPacketData();
+                helper->addPacketInfo(info);
 
                 switch (packet.os) {
                     case PWTS::OSType::Linux: {
-                        const std::unique_ptr<CliHelperLinuxAMD> helperLA = std::make_unique<CliHelperLinuxAMD>(cmdParser, features, packet.linuxAmdData);
+                        cpacket.linuxAmdData = copyPacketData(packet.linuxAmdData);
 
-                        cpacket.linuxAmdData = packet.linuxAmdData;
+                        const std::unique_ptr<CliHelperLinuxAMD> helperLA = std::make_unique<CliHelperLinuxAMD>(cmdParser, features, cpacket.linuxAmdData);
 
                         helperLA->setClientPacketData();
+                        helperLA->addPacketInfo(info);
                     }
                         break;
                     default:
@@ -255,206 +334,175 @@ namespace PWT::CLI {
         return cpacket;
     }
 
-    void PowerTunerCLI::applyDeviceSettings(const PWTS::DaemonPacket &packet) const {
-        clientPacket = createClientPacket(packet);
+    // highest cpu or gpu index the helpers look up, plus one
+    int PowerTunerCLI::getIndexCount(const PWTS::DaemonPacket &packet) {
+        int count = 0;
 
-        service->sendApplySettingsRequest(clientPacket);
-    }
+        if (!packet.intelData.isNull())
+            count = std::max<int>(count, packet.intelData->threadData.size());
 
-    void PowerTunerCLI::onLogMessageSent(const QString &msg, const MessageType type) const {
-        switch (type) {
-            case MessageType::Info:
-                print(msg);
-                break;
-            case MessageType::Error:
-                printError(msg);
-                break;
-            default:
-                break;
-        }
-    }
+        if (!packet.amdData.isNull())
+            count = std::max<int>(count, packet.amdData->threadData.size());
 
-    void PowerTunerCLI::onServiceLogSent(const QString &msg) const {
-        logger->write(msg);
-    }
+        if (!packet.linuxData.isNull()) {
+            count = std::max<int>(count, packet.linuxData->threadData.size());
 
-    void PowerTunerCLI::onServiceError() {
-        logger->write(QStringLiteral("service error"));
-        emit quit(1);
-    }
+            if (!packet.linuxData->intelGpuData.isEmpty())
+                count = std::max(count, packet.linuxData->intelGpuData.lastKey() + 1);
 
-    void PowerTunerCLI::onServiceCommandFailed() {
-        logger->write(QStringLiteral("command failed"));
-        emit quit(1);
-    }
+            if (!packet.linuxData->amdGpuData.isEmpty())
+                count = std::max(count, packet.linuxData->amdGpuData.lastKey() + 1);
+        }
 
-    void PowerTunerCLI::onServiceDisconnected() {
-        logger->write(QStringLiteral("service disconnected"));
-        emit quit(0);
+        return count;
     }
 
-    void PowerTunerCLI::onServiceConnected() const {
+    Task<> PowerTunerCLI::runDaemonCommand(const QString adr, const quint16 port) {
+        if (!co_await asyncService->connectToDaemon(adr, port))
+            co_return;
+
         logger->write(QString("connected to %1:%2").arg(service->getDaemonAddress()).arg(service->getDaemonPort()));
 
         // now process set/get cmds for the daemon
         if (cmdParser->isSet(CMDArg::GET_MODE)) {
-            if (cmdParser->isSet(CMDArg::GET_DEVICE_INFO) || cmdParser->isSet(CMDArg::GET_DEVICE_DATA))
-                service->sendGetDeviceInfoPacketRequest();
+            if (cmdParser->isSet(CMDArg::GET_DEVICE_INFO))
+                co_await getDeviceInfo();
+            else if (cmdParser->isSet(CMDArg::GET_DEVICE_DATA))
+                co_await getDeviceData();
             else if (cmdParser->isSet(CMDArg::GET_DAEMON_SETTINGS))
-                service->sendGetDaemonSettingsRequest();
+                co_await getDaemonSettings();
             else if (cmdParser->isSet(CMDArg::GET_PROFILE_LIST))
-                service->sendGetProfileListRequest();
+                co_await getProfileList();
             else if (cmdParser->isSet(CMDArg::GET_EXPORT_PROFILES))
-                service->sendExportProfilesRequest(cmdParser->getCmdValue(CMDArg::GET_EXPORT_PROFILES, "profile").toString());
+                co_await exportProfiles();
 
         } else {
             if (cmdParser->isSet(CMDArg::SET_DAEMON_SETTINGS))
-                service->sendGetDaemonSettingsRequest();
+                co_await setDaemonSettings();
             else if (cmdParser->isSet(CMDArg::SET_DELETE_PROFILE))
-                service->sendDeleteProfileRequest(cmdParser->getCmdValue(CMDArg::SET_DELETE_PROFILE, "profile").toString());
+                co_await deleteProfile();
             else if (cmdParser->isSet(CMDArg::SET_APPLY_PROFILE))
-                service->sendApplyProfileRequest(cmdParser->getCmdValue(CMDArg::SET_APPLY_PROFILE, "profile").toString());
+                co_await applyProfile();
             else if (cmdParser->isSet(CMDArg::SET_IMPORT_PROFILES))
-                importProfiles();
+                co_await importProfiles();
             else if (cmdParser->isSet(CMDArg::SET_DEVICE_SETTINGS))
-                service->sendGetDeviceInfoPacketRequest();
+                co_await applyDeviceSettings();
         }
     }
 
-    void PowerTunerCLI::onServiceDeviceInfoPacketReceived(const PWTS::DeviceInfoPacket &packet) {
-        const bool isSetDeviceSettings = cmdParser->isSet(CMDArg::SET_DEVICE_SETTINGS);
-
-        if (cmdParser->isSet(CMDArg::GET_DEVICE_INFO)) {
-            setInputRanges(packet);
-            printDeviceInfo(packet, logger, inputRanges);
-            emit quit(0);
+    Task<std::optional<PWTS::DaemonPacket>> PowerTunerCLI::readDaemonPacket() {
+        co_return loadDaemonPacket(co_await asyncService->daemonPacket());
+    }
 
-        } else if (cmdParser->isSet(CMDArg::GET_DEVICE_DATA) || isSetDeviceSettings) {
-            if (isSetDeviceSettings)
-                setInputRanges(packet);
+    std::optional<PWTS::DaemonPacket> PowerTunerCLI::loadDaemonPacket(std::optional<PWTS::DaemonPacket> &&packet) {
+        if (!packet)
+            return std::nullopt;
 
-            features = packet.features;
-            coreCount = packet.cpuInfo.numCores;
-            service->sendGetDaemonPacketRequest();
-        }
-    }
+        const QString dname = cmdParser->getCmdValue(CMDArg::DAEMON, "name").toString();
 
-    void PowerTunerCLI::onServiceDaemonPacketReceived(const PWTS::DaemonPacket &packet) {
-        for (const PWTS::DError &err: packet.errors)
+        for (const PWTS::DError &err: packet->errors)
             logger->write(PWTS::getErrorStr(err));
 
-        if (cmdParser->isSet(CMDArg::GET_DEVICE_DATA)) {
-            printDeviceData(packet, features, coreCount);
-            emit quit(0);
+        capabilities = CompletionCache::getCapabilities(*packet, features, getSettingFeatures(*packet), getSettingRanges(*packet));
 
-        } else if (cmdParser->isSet(CMDArg::SET_DEVICE_SETTINGS)) {
-            applyDeviceSettings(packet);
-        }
+        // refresh shell completion data, only saved daemons are cached
+        if (!dname.isEmpty() && !completionCache->write(dname, capabilities))
+            logger->write(QString("failed to update completion cache for %1").arg(dname));
+
+        return std::move(packet);
     }
 
-    void PowerTunerCLI::onServiceDaemonSettingsReceived(const QByteArray &data) {
-        const QSharedPointer<PWTS::DaemonSettings> daemonSettings = QSharedPointer<PWTS::DaemonSettings>::create();
+    Task<std::optional<PWTS::DaemonPacket>> PowerTunerCLI::readDeviceData() {
+        // both requests are sent at once, the packet is loaded after the device info features are set
+        auto [info, packet] = co_await whenAll(replyTask(asyncService->deviceInfo()), replyTask(asyncService->daemonPacket()));
 
-        if (!daemonSettings->load(data))
-            logger->write(QStringLiteral("failed to load daemon settings, using defaults"));
+        if (!info || !packet)
+            co_return std::nullopt;
 
-        if (cmdParser->isSet(CMDArg::GET_DAEMON_SETTINGS)) {
-            printDaemonSettings(daemonSettings);
-            emit quit(0);
+        // also cached with the daemon capabilities
+        setInputRanges(*info);
 
-        } else {
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "address"))
-                daemonSettings->setAddress(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "address").toString());
+        features = FeatureSet(info->features);
+        coreCount = info->cpuInfo.numCores;
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "apply_interval"))
-                daemonSettings->setApplyInterval(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "apply_interval").toInt());
+        co_return loadDaemonPacket(std::move(packet));
+    }
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "start_profile"))
-                daemonSettings->setOnStartProfile(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "start_profile").toString());
+    Task<QSharedPointer<PWTS::DaemonSettings>> PowerTunerCLI::readDaemonSettings() {
+        const std::optional<QByteArray> data = co_await asyncService->daemonSettings();
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "battery_profile"))
-                daemonSettings->setOnBatteryProfile(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "battery_profile").toString());
+        if (!data)
+            co_return {};
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "psupply_profile"))
-                daemonSettings->setOnPowerSupplyProfile(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "psupply_profile").toString());
+        const QSharedPointer<PWTS::DaemonSettings> daemonSettings = QSharedPointer<PWTS::DaemonSettings>::create();
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "apply_on_wake"))
-                daemonSettings->setApplyOnWakeFromSleep(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "apply_on_wake").toBool());
+        if (!daemonSettings->load(*data))
+            logger->write(QStringLiteral("failed to load daemon settings, using defaults"));
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "ignore_bat_events"))
-                daemonSettings->setIgnoreBatteryEvent(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "ignore_bat_events").toBool());
+        co_return daemonSettings;
+    }
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "log_level"))
-                daemonSettings->setLogLevel(static_cast<PWTS::LogLevel>(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "log_level").toInt()));
+    Task<> PowerTunerCLI::getDeviceInfo() {
+        const std::optional<PWTS::DeviceInfoPacket> packet = co_await asyncService->deviceInfo();
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "max_log_files"))
-                daemonSettings->setMaxLogFiles(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "max_log_files").toInt());
+        if (!packet)
+            co_return;
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "tcp_port"))
-                daemonSettings->setSocketTcpPort(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "tcp_port").toUInt());
+        setInputRanges(*packet);
+        printDeviceInfo(*packet, logger, inputRanges);
+        emit quit(0);
+    }
 
-            if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "udp_port"))
-                daemonSettings->setSocketUdpPort(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "udp_port").toUInt());
+    Task<> PowerTunerCLI::getDeviceData() {
+        const std::optional<PWTS::DaemonPacket> packet = co_await readDeviceData();
 
-            service->sendApplyDaemonSettingsRequest(daemonSettings->getData());
-        }
-    }
+        if (!packet)
+            co_return;
 
-    void PowerTunerCLI::onServiceDaemonSettingsApplied(const bool diskSaveResult) {
-        if (!diskSaveResult)
-            logger->write(QStringLiteral("failed to write daemon settings to disk"));
+        if (outputFormat == OutputFormat::JSON)
+            printDeviceData(*packet, features, coreCount, deviceDataOptions);
+        else
+            printDeviceDataTable(*packet, features, outputFormat, outputTable);
 
-        emit quit(!diskSaveResult);
+        emit quit(0);
     }
 
-    void PowerTunerCLI::onServiceSettingsApplied(const QSet<PWTS::DError> &errors) {
-        for (const PWTS::DError &err: errors)
-            logger->write(PWTS::getErrorStr(err));
-
-        printApplyResults(errors);
+    Task<> PowerTunerCLI::getDaemonSettings() {
+        const QSharedPointer<PWTS::DaemonSettings> daemonSettings = co_await readDaemonSettings();
 
-        if (cmdParser->isSet(CMDArg::SET_MAKE_PROFILE)) {
-            const QString name = cmdParser->getCmdValue(CMDArg::SET_MAKE_PROFILE, "name").toString();
+        if (daemonSettings.isNull())
+            co_return;
 
-            if (!name.isEmpty()) {
-                service->sendWriteProfileRequest(name, clientPacket);
-                return;
-            }
+        printDaemonSettings(daemonSettings);
+        emit quit(0);
+    }
 
-            logger->write(QStringLiteral("profile name cannot be empty"));
-        }
+    Task<> PowerTunerCLI::getProfileList() {
+        const std::optional<QList<QString>> list = co_await asyncService->profileList();
 
-        emit quit(!errors.isEmpty());
-    }
+        if (!list)
+            co_return;
 
-    void PowerTunerCLI::onServiceProfileListReceived(const QList<QString> &list) {
-        printProfileList(list);
+        printProfileList(*list);
         emit quit(0);
     }
 
-    void PowerTunerCLI::onServiceProfileDeleted(const bool result) {
-        if (!result)
-            logger->write(QString("failed to delete profile '%1'").arg(cmdParser->getCmdValue(CMDArg::SET_DELETE_PROFILE, "profile").toString()));
+    Task<> PowerTunerCLI::exportProfiles() {
+        const std::optional<QHash<QString, QByteArray>> exported = co_await asyncService->exportProfiles(cmdParser->getCmdValue(CMDArg::GET_EXPORT_PROFILES, "profile").toString());
 
-        emit quit(!result);
-    }
+        if (!exported)
+            co_return;
 
-    void PowerTunerCLI::onServiceProfileApplied(const QSet<PWTS::DError> &errors, const QString &name) {
-        printApplyResults(errors, name);
-        emit quit(!errors.isEmpty());
-    }
-
-    void PowerTunerCLI::onServiceProfilesExported(const QHash<QString, QByteArray> &exported) {
         const QString path = cmdParser->getCmdValue(CMDArg::GET_EXPORT_PROFILES, "path").toString();
         const QDir qdir(path);
 
         if (!qdir.exists() && !qdir.mkpath(path)) {
             logger->write("failed to create profiles export path");
             emit quit(1);
-            return;
+            co_return;
         }
 
-        for (const auto &[name, data]: exported.asKeyValueRange()) {
+        for (const auto &[name, data]: exported->asKeyValueRange()) {
             QFile profileF {QString("%1/%2").arg(path, name)};
 
             if (!profileF.open(QFile::WriteOnly)) {
@@ -469,17 +517,292 @@ namespace PWT::CLI {
         emit quit(0);
     }
 
-    void PowerTunerCLI::onServiceProfilesImported(const bool result) {
+    Task<> PowerTunerCLI::setDaemonSettings() {
+        const QSharedPointer<PWTS::DaemonSettings> daemonSettings = co_await readDaemonSettings();
+
+        if (daemonSettings.isNull())
+            co_return;
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "address"))
+            daemonSettings->setAddress(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "address").toString());
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "apply_interval"))
+            daemonSettings->setApplyInterval(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "apply_interval").toInt());
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "start_profile"))
+            daemonSettings->setOnStartProfile(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "start_profile").toString());
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "battery_profile"))
+            daemonSettings->setOnBatteryProfile(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "battery_profile").toString());
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "psupply_profile"))
+            daemonSettings->setOnPowerSupplyProfile(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "psupply_profile").toString());
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "apply_on_wake"))
+            daemonSettings->setApplyOnWakeFromSleep(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "apply_on_wake").toBool());
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "ignore_bat_events"))
+            daemonSettings->setIgnoreBatteryEvent(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "ignore_bat_events").toBool());
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "log_level"))
+            daemonSettings->setLogLevel(static_cast<PWTS::LogLevel>(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "log_level").toInt()));
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "max_log_files"))
+            daemonSettings->setMaxLogFiles(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "max_log_files").toInt());
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "tcp_port"))
+            daemonSettings->setSocketTcpPort(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "tcp_port").toUInt());
+
+        if (cmdParser->hasCmdValue(CMDArg::SET_DAEMON_SETTINGS, "udp_port"))
+            daemonSettings->setSocketUdpPort(cmdParser->getCmdValue(CMDArg::SET_DAEMON_SETTINGS, "udp_port").toUInt());
+
+        const std::optional<bool> diskSaveResult = co_await asyncService->applyDaemonSettings(daemonSettings->getData());
+
+        if (!diskSaveResult)
+            co_return;
+
+        if (!*diskSaveResult)
+            logger->write(QStringLiteral("failed to write daemon settings to disk"));
+
+        emit quit(!*diskSaveResult);
+    }
+
+    Task<> PowerTunerCLI::deleteProfile() {
+        const QString profile = cmdParser->getCmdValue(CMDArg::SET_DELETE_PROFILE, "profile").toString();
+        const std::optional<bool> result = co_await asyncService->deleteProfile(profile);
+
         if (!result)
-            logger->write(QStringLiteral("failed to import some profiles"));
+            co_return;
+
+        if (!*result)
+            logger->write(QString("failed to delete profile '%1'").arg(profile));
 
-        emit quit(!result);
+        emit quit(!*result);
     }
 
-    void PowerTunerCLI::onServiceProfileWritten(const bool result) {
+    Task<> PowerTunerCLI::applyProfile() {
+        const std::optional<std::pair<QSet<PWTS::DError>, QString>> applied = co_await asyncService->applyProfile(cmdParser->getCmdValue(CMDArg::SET_APPLY_PROFILE, "profile").toString());
+
+        if (!applied)
+            co_return;
+
+        const auto &[errors, name] = *applied;
+
+        if (!cmdParser->isSet(CMDArg::SET_VERIFY)) {
+            printApplyResults(errors, name);
+            emit quit(!errors.isEmpty());
+            co_return;
+        }
+
+        // features are needed to read device data
+        const std::optional<PWTS::DaemonPacket> packet = co_await readDeviceData();
+
+        if (!packet)
+            co_return;
+
+        QJsonObject verify;
+
+        // profile data is only known to the daemon, return what the device reports
+        verify.insert("device_data", getDeviceDataJson(*packet, features, coreCount, deviceDataOptions));
+        printApplyResults(errors, name, verify);
+        emit quit(!errors.isEmpty());
+    }
+
+    Task<> PowerTunerCLI::importProfiles() {
+        const QList<QString> list = cmdParser->getCmdValue(CMDArg::SET_IMPORT_PROFILES, "profiles").toStringList();
+        QHash<QString, QByteArray> imports;
+
+        for (const QString &file: list) {
+            if (!PWTS::isValidProfileForImport(file))
+                continue;
+
+            const QFileInfo finfo {file};
+            QFile f {file};
+
+            if (f.open(QFile::ReadOnly))
+                imports.insert(finfo.baseName(), f.readAll());
+            else
+                logger->write(QString("cannot import profile '%1', skip").arg(file));
+        }
+
+        const std::optional<bool> result = co_await asyncService->importProfiles(imports);
+
         if (!result)
-            logger->write(QStringLiteral("failed to write profile"));
+            co_return;
+
+        if (!*result)
+            logger->write(QStringLiteral("failed to import some profiles"));
+
+        emit quit(!*result);
+    }
+
+    Task<> PowerTunerCLI::applyDeviceSettings() {
+        const std::optional<PWTS::DaemonPacket> deviceData = co_await readDeviceData();
+
+        if (!deviceData)
+            co_return;
+
+        const PWTS::DaemonPacket &packet = *deviceData;
+
+        // groups are rejected when the device topology cannot tell them apart
+        if (cmdParser->needsTopology()) {
+            const QList<Setting> unresolved = cmdParser->resolveTopology(CpuTopology(packet, coreCount));
+
+            if (!unresolved.isEmpty()) {
+                for (const Setting setting: unresolved)
+                    logger->write(QString("%1: topology group not available on this device").arg(settingName(setting)));
+
+                emit quit(1);
+                co_return;
+            }
+        }
+
+        // checked again on the device data, daemons given by address have no cached capabilities
+        if (cmdParser->isSet(CMDArg::SET_STRICT)) {
+            const QList<SettingError> errors = cmdParser->validateSettings(capabilities);
+
+            if (!errors.isEmpty()) {
+                printSettingErrors(errors);
+                emit quit(1);
+                co_return;
+            }
+        }
+
+        cmdParser->expandIndexedSettings(getIndexCount(packet));
+
+        const bool dryRun = cmdParser->isSet(CMDArg::SET_DRY_RUN);
+        const bool verify = cmdParser->isSet(CMDArg::SET_VERIFY);
+        ClientPacketInfo info;
+        QJsonObject currentData;
+        QJsonObject plannedData;
+
+        if (dryRun || verify)
+            currentData = getDeviceDataJson(packet, features, coreCount, deviceDataOptions);
+
+        const PWTS::ClientPacket clientPacket = createClientPacket(packet, info);
+
+        // nothing is sent if any setting is not applied as given
+        if (cmdParser->isSet(CMDArg::SET_STRICT) && (!info.invalid.isEmpty() || !info.clamped.isEmpty())) {
+            QList<SettingError> errors;
 
-        emit quit(!result);
+            for (const InvalidValue &invalid: info.invalid)
+                errors.append({invalid.setting, SettingError::Kind::InvalidValue, invalid.value, std::nullopt});
+
+            for (const ClampedValue &clamped: info.clamped)
+                errors.append({clamped.setting, SettingError::Kind::OutOfRange, QString::number(clamped.requested), std::nullopt});
+
+            printSettingErrors(errors);
+            emit quit(1);
+            co_return;
+        }
+
+        if (dryRun || verify) {
+            PWTS::DaemonPacket planned = packet;
+
+            planned.fanData = clientPacket.fanData;
+            planned.linuxData = clientPacket.linuxData;
+            planned.windowsData = clientPacket.windowsData;
+            planned.intelData = clientPacket.intelData;
+            planned.amdData = clientPacket.amdData;
+            planned.linuxAmdData = clientPacket.linuxAmdData;
+            plannedData = getDeviceDataJson(planned, features, coreCount, deviceDataOptions);
+        }
+
+        if (dryRun) {
+            printApplyPlan(currentData, plannedData, info);
+            emit quit(0);
+            co_return;
+        }
+
+        // profiles need the full packet, always apply it
+        if (info.changes == 0 && !cmdParser->isSet(CMDArg::SET_FORCE_APPLY) && !cmdParser->isSet(CMDArg::SET_MAKE_PROFILE)) {
+            logger->write(QStringLiteral("device settings already match, no-op"));
+            printApplyNoop();
+            emit quit(0);
+            co_return;
+        }
+
+        const QJsonObject verifyChanges = verify ? getDeviceDataDiffJson(currentData, plannedData) : QJsonObject();
+        const std::optional<QSet<PWTS::DError>> errors = co_await asyncService->applySettings(clientPacket);
+
+        if (!errors)
+            co_return;
+
+        for (const PWTS::DError &err: *errors)
+            logger->write(PWTS::getErrorStr(err));
+
+        if (!verify) {
+            printApplyResults(*errors, "", {}, info.collapsed);
+            co_await writeProfileOrQuit(errors->isEmpty(), clientPacket);
+            co_return;
+        }
+
+        // read device data back on this connection, results are printed after it
+        const std::optional<PWTS::DaemonPacket> appliedData = co_await readDaemonPacket();
+
+        if (!appliedData)
+            co_return;
+
+        const QJsonObject mismatches = getVerifyJson(verifyChanges, getDeviceDataJson(*appliedData, features, coreCount, deviceDataOptions));
+        QJsonObject verifyData;
+
+        verifyData.insert("mismatches", mismatches);
+        printApplyResults(*errors, "", verifyData, info.collapsed);
+        co_await writeProfileOrQuit(errors->isEmpty() && mismatches.isEmpty(), clientPacket);
+    }
+
+    Task<> PowerTunerCLI::writeProfileOrQuit(const bool success, const PWTS::ClientPacket packet) {
+        if (cmdParser->isSet(CMDArg::SET_MAKE_PROFILE)) {
+            const QString name = cmdParser->getCmdValue(CMDArg::SET_MAKE_PROFILE, "name").toString();
+
+            if (!name.isEmpty()) {
+                const std::optional<bool> result = co_await asyncService->writeProfile(name, packet);
+
+                if (!result)
+                    co_return;
+
+                if (!*result)
+                    logger->write(QStringLiteral("failed to write profile"));
+
+                emit quit(!(success && *result));
+                co_return;
+            }
+
+            logger->write(QStringLiteral("profile name cannot be empty"));
+        }
+
+        emit quit(!success);
+    }
+
+    void PowerTunerCLI::onLogMessageSent(const QString &msg, const MessageType type) const {
+        switch (type) {
+            case MessageType::Info:
+                print(msg);
+                break;
+            case MessageType::Error:
+                printError(msg);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void PowerTunerCLI::onServiceLogSent(const QString &msg) const {
+        logger->write(msg);
+    }
+
+    void PowerTunerCLI::onServiceError() {
+        logger->write(QStringLiteral("service error"));
+        emit quit(1);
+    }
+
+    void PowerTunerCLI::onServiceCommandFailed() {
+        logger->write(QStringLiteral("command failed"));
+        emit quit(1);
+    }
+
+    void PowerTunerCLI::onServiceDisconnected() {
+        logger->write(QStringLiteral("service disconnected"));
+        emit quit(0);
     }
 }
@@ -18,8 +18,13 @@
 #pragma once
 
 #include "CMDParser/CMDParser.h"
+#include "Classes/AsyncService.h"
 #include "Classes/CLISettings.h"
+#include "Classes/CompletionCache.h"
 #include "Classes/FileLogger.h"
+#include "Classes/Task.h"
+#include "Commands/AppCommands.h"
+#include "Include/OutputFormat.h"
 #include "pwtClientCommon/InputRanges/InputRanges.h"
 #include "pwtClientService/ClientService.h"
 #include "pwtShared/Include/Packets/ClientPacket.h"
@@ -32,22 +37,49 @@ namespace PWT::CLI {
     private:
         QSharedPointer<CMDParser> cmdParser;
         QScopedPointer<CLISettings> cliSettings;
+        QScopedPointer<CompletionCache> completionCache;
         QSharedPointer<FileLogger> logger;
         QSharedPointer<UI::InputRanges> inputRanges;
         QScopedPointer<PWTCS::ClientService> service;
-        mutable PWTS::ClientPacket clientPacket;
-        PWTS::Features features;
+        QScopedPointer<AsyncService> asyncService;
+        FeatureSet features;
+        DeviceCapabilities capabilities; // of the last daemon packet
+        DeviceDataOptions deviceDataOptions;
+        OutputFormat outputFormat = OutputFormat::JSON;
+        DeviceDataTable outputTable = DeviceDataTable::CPUs;
         int coreCount;
         QString globalDataPath;
         QString dataPath;
 
+        [[nodiscard]] static int getIndexCount(const PWTS::DaemonPacket &packet);
+        [[nodiscard]] bool validateStrictSettings() const;
+        [[nodiscard]] QMap<Setting, SettingBounds> getSettingRanges(const PWTS::DaemonPacket &packet) const;
+        [[nodiscard]] QMap<Setting, SettingFeatures> getSettingFeatures(const PWTS::DaemonPacket &packet) const;
         void setInputRanges(const PWTS::DeviceInfoPacket &packet);
+        [[nodiscard]] bool initOutputOptions();
         void runGetCommand();
         void runSetCommand();
         void initService();
-        void importProfiles() const;
-        PWTS::ClientPacket createClientPacket(const PWTS::DaemonPacket &packet) const;
-        void applyDeviceSettings(const PWTS::DaemonPacket &packet) const;
+        PWTS::ClientPacket createClientPacket(const PWTS::DaemonPacket &packet, ClientPacketInfo &info) const;
+        [[nodiscard]] std::optional<PWTS::DaemonPacket> loadDaemonPacket(std::optional<PWTS::DaemonPacket> &&packet);
+
+        // daemon commands, each one ends with quit.
+        // coroutines outlive the caller arguments, take them by value
+        Task<> runDaemonCommand(QString adr, quint16 port);
+        Task<std::optional<PWTS::DaemonPacket>> readDaemonPacket();
+        Task<std::optional<PWTS::DaemonPacket>> readDeviceData();
+        Task<QSharedPointer<PWTS::DaemonSettings>> readDaemonSettings();
+        Task<> getDeviceInfo();
+        Task<> getDeviceData();
+        Task<> getDaemonSettings();
+        Task<> getProfileList();
+        Task<> exportProfiles();
+        Task<> setDaemonSettings();
+        Task<> deleteProfile();
+        Task<> applyProfile();
+        Task<> importProfiles();
+        Task<> applyDeviceSettings();
+        Task<> writeProfileOrQuit(bool success, PWTS::ClientPacket packet);
 
     public:
         PowerTunerCLI();
@@ -60,18 +92,6 @@ namespace PWT::CLI {
         void onServiceError();
         void onServiceCommandFailed();
         void onServiceDisconnected();
-        void onServiceConnected() const;
-        void onServiceDeviceInfoPacketReceived(const PWTS::DeviceInfoPacket &packet);
-        void onServiceDaemonPacketReceived(const PWTS::DaemonPacket &packet);
-        void onServiceDaemonSettingsReceived(const QByteArray &data);
-        void onServiceDaemonSettingsApplied(bool diskSaveResult);
-        void onServiceSettingsApplied(const QSet<PWTS::DError> &errors);
-        void onServiceProfileListReceived(const QList<QString> &list);
-        void onServiceProfileDeleted(bool result);
-        void onServiceProfileApplied(const QSet<PWTS::DError> &errors, const QString &name);
-        void onServiceProfilesExported(const QHash<QString, QByteArray> &exported);
-        void onServiceProfilesImported(bool result);
-        void onServiceProfileWritten(bool result);
 
     signals:
         void quit(int code);
@@ -18,6 +18,7 @@
 #include <QCoreApplication>
 
 #include "PowerTunerCLI.h"
+#include "Classes/OutputWriter.h"
 
 int main(int argc, char *argv[]) {
     QCoreApplication::setApplicationName("PowerTunerCLI");
@@ -32,5 +33,12 @@ int main(int argc, char *argv[]) {
     QObject::connect(cli.get(), &PWT::CLI::PowerTunerCLI::quit, &a, &QCoreApplication::exit, Qt::QueuedConnection);
 
     cli->run(argc, argv);
-    return a.exec();
+
+    const int ret = a.exec();
+
+    // the output file is kept when its content was written completely
+    if (!PWT::CLI::OutputWriter::getInstance()->finish() && ret == 0)
+        return 1;
+
+    return ret;
 }
@@ -0,0 +1,127 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <QElapsedTimer>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../../src/CMDParser/CMDParser.h"
+
+static constinit std::atomic<quint64> allocations = 0;
+
+#ifdef __GLIBC__
+// count every heap allocation, Qt containers do not go through operator new
+extern "C" {
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t count, size_t size);
+    void *__libc_realloc(void *ptr, size_t size);
+
+    void *malloc(const size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_malloc(size);
+    }
+
+    void *calloc(const size_t count, const size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_calloc(count, size);
+    }
+
+    void *realloc(void *ptr, const size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_realloc(ptr, size);
+    }
+}
+#endif
+
+static void silentMessageHandler(QtMsgType, const QMessageLogContext &, const QString &) {}
+
+// synthetic set device-settings command line, cycling through all settings
+static QList<QByteArray> makeArguments(const int count) {
+    QList<QByteArray> args {"PowerTunerCLI", "set", "device-settings", "localhost;5566"};
+
+    for (int i=0; i<count; ++i) {
+        const PWT::CLI::SettingInfo &setting = PWT::CLI::settingsSchema[i % PWT::CLI::settingsCount];
+        const int idx = i / PWT::CLI::settingsCount;
+        QByteArray arg(setting.name.data(), static_cast<qsizetype>(setting.name.size()));
+
+        switch (setting.scope) {
+            case PWT::CLI::SettingScope::Global:
+                break;
+            case PWT::CLI::SettingScope::Thread:
+            case PWT::CLI::SettingScope::Core:
+            case PWT::CLI::SettingScope::GPU:
+                arg.append('[').append(QByteArray::number(idx)).append(']');
+                break;
+            default:
+                arg.append("[dev").append(QByteArray::number(idx)).append(']');
+                break;
+        }
+
+        arg.append(setting.type == PWT::CLI::SettingType::String ? "=value" : "=1");
+        args.append(arg);
+    }
+
+    return args;
+}
+
+int main() {
+    constexpr int iterations = 20;
+
+    qInstallMessageHandler(silentMessageHandler);
+    std::printf("%10s %14s %14s %16s %16s %12s\n", "arguments", "parse (us)", "us/argument", "allocs/argument", "arena/argument", "arena KiB");
+
+    for (const int count: {1000, 2000, 5000, 10000}) {
+        QList<QByteArray> args = makeArguments(count);
+        QList<char *> argv;
+        qint64 elapsed = 0;
+        quint64 allocs = 0;
+        PWT::CLI::CommandArena::Stats arena;
+
+        for (QByteArray &arg: args)
+            argv.append(arg.data());
+
+        argv.append(nullptr);
+
+        for (int i=0; i<iterations; ++i) {
+            // parse may advance argv
+            QList<char *> runArgv = argv;
+            PWT::CLI::CMDParser parser;
+            QElapsedTimer timer;
+            const quint64 allocsStart = allocations.load(std::memory_order_relaxed);
+
+            timer.start();
+
+            if (!parser.parse(static_cast<int>(runArgv.size() - 1), runArgv.data())) {
+                std::fprintf(stderr, "parse failed\n");
+                return 1;
+            }
+
+            elapsed += timer.nsecsElapsed();
+            allocs += allocations.load(std::memory_order_relaxed) - allocsStart;
+            arena = parser.arenaStats();
+        }
+
+        const double parseUs = static_cast<double>(elapsed) / iterations / 1000.0;
+
+        // arena requests are served without going to the heap, heap chunks are in allocs
+        std::printf("%10d %14.1f %14.3f %16.2f %16.2f %12.1f\n", count, parseUs, parseUs / count,
+            static_cast<double>(allocs) / iterations / count, static_cast<double>(arena.allocations) / count, static_cast<double>(arena.bytes) / 1024.0);
+    }
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of PowerTunerCLI.
+ * Copyright (C) 2025 kylon
+ *
+ * PowerTunerCLI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PowerTunerCLI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <QCoreApplication>
+#include <QDirIterator>
+#include <QFile>
+#include <cstdio>
+
+#include "../../src/CMDParser/CMDParser.h"
+
+static void silentMessageHandler(QtMsgType, const QMessageLogContext &, const QString &) {}
+
+extern "C" int LLVMFuzzerInitialize(int *, char ***) {
+    // drop help text and parse errors
+    qInstallMessageHandler(silentMessageHandler);
+    std::freopen("/dev/null", "w", stdout);
+
+    return 0;
+}
+
+// input is a list of NUL separated arguments, argv[0] is added here
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, const size_t size) {
+    QList<QByteArray> args = QByteArray(reinterpret_cast<const char *>(data), static_cast<qsizetype>(size)).split('\0');
+    QList<char *> argv {const_cast<char *>("PowerTunerCLI")};
+
+    for (QByteArray &arg: args) {
+        // --from reads files or stdin, not what we are fuzzing here
+        if (arg.startsWith("--from"))
+            return -1;
+
+        argv.append(arg.data());
+    }
+
+    argv.append(nullptr);
+
+    PWT::CLI::CMDParser parser;
+
+    [[maybe_unused]] const bool ret = parser.parse(static_cast<int>(argv.size() - 1), argv.data());
+    return 0;
+}
+
+#ifdef FUZZ_STANDALONE
+// run inputs without libFuzzer: CMDParserFuzz <file|dir>..
+int main(int argc, char *argv[]) {
+    int count = 0;
+
+    LLVMFuzzerInitialize(&argc, &argv);
+
+    const auto runFile = [&count](const QString &path) {
+        QFile file(path);
+
+        if (!file.open(QIODevice::ReadOnly))
+            return;
+
+        const QByteArray data = file.readAll();
+
+        LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t *>(data.constData()), data.size());
+        ++count;
+    };
+
+    for (int i=1; i<argc; ++i) {
+        QDirIterator it(argv[i], QDir::Files, QDirIterator::Subdirectories);
+
+        if (!it.hasNext())
+            runFile(argv[i]);
+
+        while (it.hasNext())
+            runFile(it.next());
+    }
+
+    std::fprintf(stderr, "executed %d inputs\n", count);
+    return 0;
+}
+#endif